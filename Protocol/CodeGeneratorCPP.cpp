@@ -5,7 +5,11 @@
 //  Created by Wahid Tanner on 10/17/14.
 //
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <boost/algorithm/string.hpp>
@@ -142,11 +146,18 @@ string Protocol::CodeGeneratorCPP::headerIncludeBlockText (const std::string & h
 
 void Protocol::CodeGeneratorCPP::writeStandardIncludeFileNamesToHeader (CodeWriter & headerFileWriter, bool includeBase) const
 {
+    headerFileWriter.writeIncludeLibrary("atomic");
     headerFileWriter.writeIncludeLibrary("cstdint");
+    headerFileWriter.writeIncludeLibrary("cstring");
+    headerFileWriter.writeIncludeLibrary("istream");
+    headerFileWriter.writeIncludeLibrary("limits");
     headerFileWriter.writeIncludeLibrary("memory");
+    headerFileWriter.writeIncludeLibrary("ostream");
     headerFileWriter.writeIncludeLibrary("stdexcept");
     headerFileWriter.writeIncludeLibrary("string");
+    headerFileWriter.writeIncludeLibrary("thread");
     headerFileWriter.writeIncludeLibrary("type_traits");
+    headerFileWriter.writeIncludeLibrary("utility");
     headerFileWriter.writeIncludeLibrary("vector");
     headerFileWriter.writeBlankLine();
 
@@ -400,7 +411,7 @@ void Protocol::CodeGeneratorCPP::writeMessageToHeader (CodeWriter & headerFileWr
     }
 
     string baseClass = "public " + mBaseClassesNamespace + "::ProtoMessage";
-    headerFileWriter.writeClassOpening(className, baseClass);
+    headerFileWriter.writeClassOpening(className, baseClass, true);
 
     headerFileWriter.writeClassPublic();
 
@@ -446,32 +457,54 @@ void Protocol::CodeGeneratorCPP::writeMessageToHeader (CodeWriter & headerFileWr
 
     writeMessageSwapToHeader(headerFileWriter, protoModel, messageModel, className);
 
+    writeMessageDeepCopyToHeader(headerFileWriter, protoModel, messageModel, className);
+
     writeMessageClearToHeader(headerFileWriter, protoModel, messageModel, className);
 
+    string usingName = mBaseClassesNamespace + "::ProtoMessage::parse";
+    headerFileWriter.writeUsingDeclaration(usingName);
+
+    usingName = mBaseClassesNamespace + "::ProtoMessage::writeTo";
+    headerFileWriter.writeUsingDeclaration(usingName);
+
+    usingName = mBaseClassesNamespace + "::ProtoMessage::byteSize";
+    headerFileWriter.writeUsingDeclaration(usingName);
+
     string methodName = "parse";
     string methodReturn = "size_t";
-    string methodParameters = "const char * pData";
+    string methodParameters = "const char * pData, size_t available";
     headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, false, true);
 
-    methodName = "serialize";
-    methodReturn = "std::string";
-    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, true, true);
+    methodName = "parseAliased";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, false, true);
+
+    methodName = "parseField";
+    methodParameters = "std::uint32_t fieldKey, const char * pData, size_t available, bool aliased";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, false, true);
+
+    methodName = "writeTo";
+    methodReturn = "char *";
+    methodParameters = "char * pData, const char * pTag, unsigned int tagSize";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, true, true);
 
     methodName = "byteSize";
     methodReturn = "size_t";
-    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, true, true);
+    methodParameters = "unsigned int tagSize";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, true, true);
 
     methodName = "valid";
     methodReturn = "bool";
     headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, true, true);
 
+    writeMessageUnknownFieldsToHeader(headerFileWriter);
+
     auto messageFieldBegin = messageModel.fields()->cbegin();
     auto messageFieldEnd = messageModel.fields()->cend();
     while (messageFieldBegin != messageFieldEnd)
     {
         auto messageFieldModel = *messageFieldBegin;
 
-        writeMessageFieldToHeader(headerFileWriter, protoModel, *messageFieldModel);
+        writeMessageFieldToHeader(headerFileWriter, protoModel, messageModel, *messageFieldModel);
 
         ++messageFieldBegin;
     }
@@ -482,13 +515,24 @@ void Protocol::CodeGeneratorCPP::writeMessageToHeader (CodeWriter & headerFileWr
     {
         auto oneofModel = *oneofBegin;
 
-        writeOneofToHeader(headerFileWriter, protoModel, *oneofModel);
+        writeOneofToHeader(headerFileWriter, protoModel, messageModel, *oneofModel);
 
         ++oneofBegin;
     }
 
     headerFileWriter.writeClassPrivate();
 
+    methodName = "parseMessage";
+    methodReturn = "size_t";
+    methodParameters = "const char * pData, size_t available, bool aliased";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters);
+
+    methodName = "contentByteSize";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, true);
+
+    methodName = "cachedContentByteSize";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, true);
+
     string classDataName = className + "Data";
     headerFileWriter.writeStructOpening(classDataName);
 
@@ -517,12 +561,62 @@ void Protocol::CodeGeneratorCPP::writeMessageToHeader (CodeWriter & headerFileWr
     headerFileWriter.writeBlankLine();
 
     methodName = classDataName;
-    headerFileWriter.writeClassMethodDeclaration(methodName);
+    methodReturn = "";
+    methodParameters = mBaseClassesNamespace + "::Arena * pArena";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters);
 
-    methodName = "~";
-    methodName += classDataName;
-    headerFileWriter.writeClassMethodInlineOpening(methodName);
-    headerFileWriter.writeClassMethodInlineClosing();
+    // Clears every field in place so that collections and strings keep their storage.
+    methodName = "clear";
+    methodReturn = "void";
+    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn);
+
+    if (epochPresence(protoModel, messageModel))
+    {
+        messageFieldBegin = messageModel.fields()->cbegin();
+        messageFieldEnd = messageModel.fields()->cend();
+        while (messageFieldBegin != messageFieldEnd)
+        {
+            auto messageFieldModel = *messageFieldBegin;
+
+            writeMessageDataFieldCurrentToHeader(headerFileWriter, *messageFieldModel);
+
+            ++messageFieldBegin;
+        }
+
+        oneofBegin = messageModel.oneofs()->cbegin();
+        oneofEnd = messageModel.oneofs()->cend();
+        while (oneofBegin != oneofEnd)
+        {
+            auto oneofModel = *oneofBegin;
+
+            messageFieldBegin = oneofModel->fields()->cbegin();
+            messageFieldEnd = oneofModel->fields()->cend();
+            while (messageFieldBegin != messageFieldEnd)
+            {
+                auto messageFieldModel = *messageFieldBegin;
+
+                writeMessageDataFieldCurrentToHeader(headerFileWriter, *messageFieldModel);
+
+                ++messageFieldBegin;
+            }
+
+            ++oneofBegin;
+        }
+    }
+
+    // Declaring a destructor would stop the compiler from providing moves for inline data.
+    if (!inlineStorage(protoModel, messageModel))
+    {
+        methodName = "~";
+        methodName += classDataName;
+        headerFileWriter.writeClassMethodInlineOpening(methodName);
+        headerFileWriter.writeClassMethodInlineClosing();
+    }
+
+    if (optimizeForCodeSize(protoModel, messageModel))
+    {
+        writeMessageFieldTableToHeader(headerFileWriter, messageModel);
+    }
 
     messageFieldBegin = messageModel.fields()->cbegin();
     messageFieldEnd = messageModel.fields()->cend();
@@ -546,27 +640,71 @@ void Protocol::CodeGeneratorCPP::writeMessageToHeader (CodeWriter & headerFileWr
         ++oneofBegin;
     }
 
-    headerFileWriter.writeBlankLine();
+    string unknownFieldName = "mUnknownFields";
+    string unknownFieldType = "std::string";
+    headerFileWriter.writeClassFieldDeclaration(unknownFieldName, unknownFieldType);
 
-    headerFileWriter.writeClassPrivate();
+    string arenaFieldName = "mArena";
+    string arenaFieldType = mBaseClassesNamespace + "::Arena *";
+    headerFileWriter.writeClassFieldDeclaration(arenaFieldName, arenaFieldType);
 
-    methodName = classDataName;
-    methodReturn = "";
-    methodParameters = "const ";
-    methodParameters += classDataName + " & src";
-    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, false, false, false, false, true);
+    string cacheFieldName = "mContentByteSize";
+    string cacheFieldType = mBaseClassesNamespace + "::CachedByteSize";
+    headerFileWriter.writeClassFieldDeclaration(cacheFieldName, cacheFieldType);
+
+    // Presence of each singular field outside of a oneof, one bit per field in declaration order.
+    unsigned int wordCount = hasBitWordCount(messageModel);
+    if (wordCount != 0)
+    {
+        string hasBitsFieldName = "mHasBits[" + to_string(wordCount) + "]";
+        string hasBitsFieldType = "std::uint32_t";
+        headerFileWriter.writeClassFieldDeclaration(hasBitsFieldName, hasBitsFieldType);
+    }
+
+    if (epochPresence(protoModel, messageModel))
+    {
+        string epochFieldName = "mEpoch";
+        string epochFieldType = "std::uint32_t";
+        headerFileWriter.writeClassFieldDeclaration(epochFieldName, epochFieldType);
+
+        messageFieldBegin = messageModel.fields()->cbegin();
+        messageFieldEnd = messageModel.fields()->cend();
+        while (messageFieldBegin != messageFieldEnd)
+        {
+            auto messageFieldModel = *messageFieldBegin;
+
+            epochFieldName = "m" + messageFieldModel->namePascal() + "Epoch";
+            headerFileWriter.writeClassFieldDeclaration(epochFieldName, epochFieldType);
+
+            ++messageFieldBegin;
+        }
+
+        oneofBegin = messageModel.oneofs()->cbegin();
+        oneofEnd = messageModel.oneofs()->cend();
+        while (oneofBegin != oneofEnd)
+        {
+            auto oneofModel = *oneofBegin;
+
+            messageFieldBegin = oneofModel->fields()->cbegin();
+            messageFieldEnd = oneofModel->fields()->cend();
+            while (messageFieldBegin != messageFieldEnd)
+            {
+                auto messageFieldModel = *messageFieldBegin;
+
+                epochFieldName = "m" + messageFieldModel->namePascal() + "Epoch";
+                headerFileWriter.writeClassFieldDeclaration(epochFieldName, epochFieldType);
 
-    methodName = "operator =";
-    methodReturn = classDataName + " &";
-    methodParameters = "const ";
-    methodParameters += classDataName + " & rhs";
-    headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, false, false, false, false, true);
+                ++messageFieldBegin;
+            }
+
+            ++oneofBegin;
+        }
+    }
 
     headerFileWriter.writeStructClosing();
 
     string backingFieldName = "mData";
-    string backingFieldType = "std::shared_ptr<";
-    backingFieldType += className + "Data>";
+    string backingFieldType = dataTypeName(protoModel, messageModel, className);
     headerFileWriter.writeClassFieldDeclaration(backingFieldName, backingFieldType);
 
     headerFileWriter.writeClassClosing();
@@ -575,10 +713,28 @@ void Protocol::CodeGeneratorCPP::writeMessageToHeader (CodeWriter & headerFileWr
 void Protocol::CodeGeneratorCPP::writeMessageConstructorToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
                                                                   const MessageModel & messageModel, const std::string & className) const
 {
+    bool inlineData = inlineStorage(protoModel, messageModel);
+
     string methodName = className;
     string methodParameters = "";
     string initializationParameters = "mData(new ";
-    initializationParameters += className + "Data())";
+    initializationParameters += className + "Data(nullptr))";
+    if (inlineData)
+    {
+        initializationParameters = "mData(nullptr)";
+    }
+    headerFileWriter.writeConstructorImplementationOpening(methodName, methodParameters, initializationParameters);
+    headerFileWriter.writeClassMethodInlineClosing();
+
+    methodName = "explicit ";
+    methodName += className;
+    methodParameters = mBaseClassesNamespace + "::Arena * pArena";
+    initializationParameters = "mData(" + mBaseClassesNamespace + "::makeShared<";
+    initializationParameters += className + "Data>(pArena, pArena))";
+    if (inlineData)
+    {
+        initializationParameters = "mData(pArena)";
+    }
     headerFileWriter.writeConstructorImplementationOpening(methodName, methodParameters, initializationParameters);
     headerFileWriter.writeClassMethodInlineClosing();
 }
@@ -592,6 +748,12 @@ void Protocol::CodeGeneratorCPP::writeMessageCopyConstructorToHeader (CodeWriter
     string initializationParameters = "ProtoMessage(src), mData(src.mData)";
     headerFileWriter.writeConstructorImplementationOpening(methodName, methodParameters, initializationParameters);
     headerFileWriter.writeClassMethodInlineClosing();
+
+    // A moved from message with shared data has no data left until it is assigned to, cleared, or parsed.
+    methodParameters = className + " && src";
+    initializationParameters = "ProtoMessage(std::move(src)), mData(std::move(src.mData))";
+    headerFileWriter.writeConstructorImplementationOpening(methodName, methodParameters, initializationParameters, true);
+    headerFileWriter.writeClassMethodInlineClosing();
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageDestructorToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
@@ -636,6 +798,32 @@ void Protocol::CodeGeneratorCPP::writeMessageAssignmentOperatorToHeader (CodeWri
     headerFileWriter.writeLineIndented(statement);
 
     headerFileWriter.writeClassMethodInlineClosing();
+
+    methodParameters = className + " && rhs";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, false, false, true);
+
+    statement = "this == &rhs";
+    headerFileWriter.writeIfOpening(statement);
+    statement = "return *this;";
+    headerFileWriter.writeLineIndented(statement);
+    headerFileWriter.writeIfClosing();
+
+    headerFileWriter.writeBlankLine();
+
+    statement = "ProtoMessage::operator=(std::move(rhs));";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeBlankLine();
+
+    statement = "mData = std::move(rhs.mData);";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeBlankLine();
+
+    statement = "return *this;";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageSwapToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
@@ -646,8 +834,16 @@ void Protocol::CodeGeneratorCPP::writeMessageSwapToHeader (CodeWriter & headerFi
     string methodParameters = className + " * other";
     headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
 
-    string dataType = "std::shared_ptr<";
-    dataType += className + "Data>";
+    if (inlineStorage(protoModel, messageModel))
+    {
+        string statement = "std::swap(mData, other->mData);";
+        headerFileWriter.writeLineIndented(statement);
+
+        headerFileWriter.writeClassMethodInlineClosing();
+        return;
+    }
+
+    string dataType = dataTypeName(protoModel, messageModel, className);
     string statement = dataType + " thisData(mData);";
     headerFileWriter.writeLineIndented(statement);
     statement = dataType + " otherData(other->mData);";
@@ -663,6 +859,38 @@ void Protocol::CodeGeneratorCPP::writeMessageSwapToHeader (CodeWriter & headerFi
     headerFileWriter.writeClassMethodInlineClosing();
 }
 
+void Protocol::CodeGeneratorCPP::writeMessageDeepCopyToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                               const MessageModel & messageModel, const std::string & className) const
+{
+    string methodName = "deepCopy";
+    string methodReturn = className;
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, true);
+
+    // Inline data is already copied along with the message. Shared data is copied into new data of its own.
+    string statement;
+    if (inlineStorage(protoModel, messageModel))
+    {
+        statement = "return *this;";
+        headerFileWriter.writeLineIndented(statement);
+
+        headerFileWriter.writeClassMethodInlineClosing();
+        return;
+    }
+
+    statement = className + " result(*this);";
+    headerFileWriter.writeLineIndented(statement);
+    statement = "result.mData = " + mBaseClassesNamespace + "::makeShared<";
+    statement += className + "Data>(mData->mArena, *mData);";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeBlankLine();
+
+    statement = "return result;";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
 void Protocol::CodeGeneratorCPP::writeMessageClearToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
                                                             const MessageModel & messageModel, const std::string & className) const
 {
@@ -670,60 +898,146 @@ void Protocol::CodeGeneratorCPP::writeMessageClearToHeader (CodeWriter & headerF
     string methodReturn = "void";
     headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn);
 
-    string statement = "mData.reset(new ";
-    statement += className + "Data());";
+    writeMessageDataRestore(headerFileWriter, protoModel, messageModel, className);
+
+    // Data shared with copies of this message is replaced instead so the copies keep their values.
+    string statement;
+    if (!inlineStorage(protoModel, messageModel))
+    {
+        statement = "mData.use_count() > 1";
+        headerFileWriter.writeIfOpening(statement);
+
+        statement = "mData = " + mBaseClassesNamespace + "::makeShared<";
+        statement += className + "Data>(mData->mArena, mData->mArena);";
+        headerFileWriter.writeLineIndented(statement);
+        statement = "return;";
+        headerFileWriter.writeLineIndented(statement);
+
+        headerFileWriter.writeIfClosing();
+        headerFileWriter.writeBlankLine();
+    }
+
+    statement = "mData->clear();";
     headerFileWriter.writeLineIndented(statement);
     
     headerFileWriter.writeClassMethodInlineClosing();
+
+    methodName = "arena";
+    methodReturn = mBaseClassesNamespace + "::Arena *";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, true);
+
+    statement = "return mData->mArena;";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageDataRestore (CodeWriter & writer, const ProtoModel & protoModel,
+                                                          const MessageModel & messageModel, const std::string & className) const
+{
+    if (inlineStorage(protoModel, messageModel))
+    {
+        return;
+    }
+
+    // Moving a message with shared data leaves it without any so it gets new data before being used again.
+    string statement = "mData == nullptr";
+    writer.writeIfOpening(statement);
+
+    statement = "mData = " + mBaseClassesNamespace + "::makeShared<";
+    statement += className + "Data>(nullptr, nullptr);";
+    writer.writeLineIndented(statement);
+
+    writer.writeIfClosing();
+    writer.writeBlankLine();
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageUnknownFieldsToHeader (CodeWriter & headerFileWriter) const
+{
+    string methodName = "unknownFields";
+    string methodReturn = mBaseClassesNamespace + "::ByteView";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, true);
+
+    string statement = "return mData->mUnknownFields;";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+
+    methodName = "clearUnknownFields";
+    methodReturn = "void";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn);
+
+    writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+    statement = "mData->mUnknownFields.clear();";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageFieldToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                            const MessageModel & messageModel,
                                                             const MessageFieldModel & messageFieldModel) const
 {
     if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
     {
-        writeMessageFieldSizeRepeatedToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldSizeRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
+
+        writeMessageFieldGetRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldGetRepeatedToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldViewRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldSetRepeatedToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldSetRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldAddRepeatedToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldAddRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldAddNewRepeatedToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldBulkRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldClearRepeatedToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldAddNewRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
+
+        writeMessageFieldMutableRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
+
+        writeMessageFieldClearRepeatedToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
     }
     else
     {
-        writeMessageFieldHasToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldHasToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
+
+        writeMessageFieldGetToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
+
+        writeMessageFieldViewToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldGetToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldSetToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldSetToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldCreateNewToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldCreateNewToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldMutableToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
 
-        writeMessageFieldClearToHeader(headerFileWriter, protoModel, messageFieldModel);
+        writeMessageFieldClearToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel);
     }
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageOneofFieldToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                 const MessageModel & messageModel,
                                                                  const MessageFieldModel & messageFieldModel,
                                                                  const OneofModel & oneofModel) const
 {
-    writeMessageFieldHasToHeader(headerFileWriter, protoModel, messageFieldModel, &oneofModel);
+    writeMessageFieldHasToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel, &oneofModel);
 
-    writeMessageFieldGetToHeader(headerFileWriter, protoModel, messageFieldModel, &oneofModel);
+    writeMessageFieldGetToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel, &oneofModel);
 
-    writeMessageFieldSetToHeader(headerFileWriter, protoModel, messageFieldModel, &oneofModel);
+    writeMessageFieldViewToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel, &oneofModel);
 
-    writeMessageFieldCreateNewToHeader(headerFileWriter, protoModel, messageFieldModel, &oneofModel);
+    writeMessageFieldSetToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel, &oneofModel);
 
-    writeMessageFieldClearToHeader(headerFileWriter, protoModel, messageFieldModel, &oneofModel);
+    writeMessageFieldCreateNewToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel, &oneofModel);
+
+    writeMessageFieldMutableToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel, &oneofModel);
+
+    writeMessageFieldClearToHeader(headerFileWriter, protoModel, messageModel, messageFieldModel, &oneofModel);
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageFieldSizeRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                        const MessageModel & messageModel,
                                                                         const MessageFieldModel & messageFieldModel) const
 {
     string methodName = "size";
@@ -732,8 +1046,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSizeRepeatedToHeader (CodeWrit
     string methodParameters = "";
     headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, true);
 
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Collection";
+    string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, messageFieldModel);
     string statement = "return ";
     statement += fieldValueName + ".size();";
     headerFileWriter.writeLineIndented(statement);
@@ -742,6 +1055,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSizeRepeatedToHeader (CodeWrit
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageFieldGetRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                       const MessageModel & messageModel,
                                                                        const MessageFieldModel & messageFieldModel) const
 {
     string fieldType = fullTypeName(messageFieldModel);
@@ -749,8 +1063,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldGetRepeatedToHeader (CodeWrite
     string methodReturn;
     string methodParameters = "size_t index";
 
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Collection";
+    string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, messageFieldModel);
     string statement = "return ";
     statement += fieldValueName + ".value(index);";
 
@@ -786,7 +1099,31 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldGetRepeatedToHeader (CodeWrite
     headerFileWriter.writeClassMethodInlineClosing();
 }
 
+void Protocol::CodeGeneratorCPP::writeMessageFieldViewRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                        const MessageModel & messageModel,
+                                                                        const MessageFieldModel & messageFieldModel) const
+{
+    if (messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::stringType &&
+        messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::bytesType)
+    {
+        return;
+    }
+
+    string methodName = messageFieldModel.name() + "View";
+    string methodReturn = mBaseClassesNamespace + "::ByteView";
+    string methodParameters = "size_t index";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, true);
+
+    string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, messageFieldModel);
+    string statement = "return ";
+    statement += fieldValueName + ".view(index);";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
 void Protocol::CodeGeneratorCPP::writeMessageFieldSetRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                       const MessageModel & messageModel,
                                                                        const MessageFieldModel & messageFieldModel) const
 {
     string fieldType = fullTypeName(messageFieldModel);
@@ -795,8 +1132,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSetRepeatedToHeader (CodeWrite
     string methodReturn = "void";
     string methodParameters = "size_t index, ";
 
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Collection";
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
     string statement = fieldValueName + ".setValue(index, value);";
 
     switch (messageFieldModel.fieldCategory())
@@ -807,8 +1143,10 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSetRepeatedToHeader (CodeWrite
         {
             methodParameters += fieldType + " value";
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
             headerFileWriter.writeLineIndented(statement);
+            headerFileWriter.writeClassMethodInlineClosing();
             break;
         }
 
@@ -816,22 +1154,32 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSetRepeatedToHeader (CodeWrite
         case MessageFieldModel::FieldCategory::bytesType:
         case MessageFieldModel::FieldCategory::messageType:
         {
-            methodParameters += "const ";
+            methodParameters = "size_t index, const ";
             methodParameters += fieldType + " & value";
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+
+            headerFileWriter.writeLineIndented(statement);
+            headerFileWriter.writeClassMethodInlineClosing();
+
+            methodParameters = "size_t index, ";
+            methodParameters += fieldType + " && value";
+            headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
+            statement = fieldValueName + ".setValue(index, std::move(value));";
             headerFileWriter.writeLineIndented(statement);
+            headerFileWriter.writeClassMethodInlineClosing();
             break;
         }
 
         default:
             break;
     }
-
-    headerFileWriter.writeClassMethodInlineClosing();
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageFieldAddRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                       const MessageModel & messageModel,
                                                                        const MessageFieldModel & messageFieldModel) const
 {
     string fieldType = fullTypeName(messageFieldModel);
@@ -840,8 +1188,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldAddRepeatedToHeader (CodeWrite
     string methodReturn = "void";
     string methodParameters = "";
 
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Collection";
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
     string statement = fieldValueName + ".addValue(value);";
 
     switch (messageFieldModel.fieldCategory())
@@ -852,8 +1199,10 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldAddRepeatedToHeader (CodeWrite
         {
             methodParameters += fieldType + " value";
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
             headerFileWriter.writeLineIndented(statement);
+            headerFileWriter.writeClassMethodInlineClosing();
             break;
         }
 
@@ -861,102 +1210,206 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldAddRepeatedToHeader (CodeWrite
         case MessageFieldModel::FieldCategory::bytesType:
         case MessageFieldModel::FieldCategory::messageType:
         {
-            methodParameters += "const ";
+            methodParameters = "const ";
             methodParameters += fieldType + " & value";
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+
+            headerFileWriter.writeLineIndented(statement);
+            headerFileWriter.writeClassMethodInlineClosing();
+
+            methodParameters = fieldType + " && value";
+            headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
+            statement = fieldValueName + ".addValue(std::move(value));";
             headerFileWriter.writeLineIndented(statement);
+            headerFileWriter.writeClassMethodInlineClosing();
             break;
         }
 
         default:
             break;
     }
-
-    headerFileWriter.writeClassMethodInlineClosing();
 }
 
-void Protocol::CodeGeneratorCPP::writeMessageFieldAddNewRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
-                                                                          const MessageFieldModel & messageFieldModel) const
+void Protocol::CodeGeneratorCPP::writeMessageFieldMutableRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                           const MessageModel & messageModel,
+                                                                           const MessageFieldModel & messageFieldModel) const
 {
-    string fieldType = fullTypeName(messageFieldModel);
-    string methodName = "addNew";
-    methodName += messageFieldModel.namePascal();
-    string methodReturn = fieldType + " &";
-    string methodParameters = "";
-
     switch (messageFieldModel.fieldCategory())
     {
+        case MessageFieldModel::FieldCategory::stringType:
+        case MessageFieldModel::FieldCategory::bytesType:
         case MessageFieldModel::FieldCategory::messageType:
-        {
-            headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
-
-            string fieldValueName = "mData->m";
-            fieldValueName += messageFieldModel.namePascal() + "Collection";
-            string statement = "return ";
-            statement += fieldValueName + ".addNewValue();";
-            headerFileWriter.writeLineIndented(statement);
-
-            headerFileWriter.writeClassMethodInlineClosing();
             break;
-        }
 
         default:
-            break;
+            return;
     }
-}
 
-void Protocol::CodeGeneratorCPP::writeMessageFieldClearRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
-                                                                         const MessageFieldModel & messageFieldModel) const
-{
-    string methodName = "clear";
+    string fieldType = fullTypeName(messageFieldModel);
+    string methodName = "mutable";
     methodName += messageFieldModel.namePascal();
-    string methodReturn = "void";
-    string methodParameters = "";
-
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Collection";
-    string statement = fieldValueName + ".clearValue();";
-
+    string methodReturn = fieldType + " &";
+    string methodParameters = "size_t index";
     headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+    writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
+    string statement = "return ";
+    statement += fieldValueName + ".mutableValue(index);";
     headerFileWriter.writeLineIndented(statement);
 
     headerFileWriter.writeClassMethodInlineClosing();
 }
 
-void Protocol::CodeGeneratorCPP::writeMessageFieldHasToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
-                                                               const MessageFieldModel & messageFieldModel,
-                                                               const OneofModel * oneofModel) const
+void Protocol::CodeGeneratorCPP::writeMessageFieldBulkRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                        const MessageModel & messageModel,
+                                                                        const MessageFieldModel & messageFieldModel) const
 {
-    string methodName = "has";
-    methodName += messageFieldModel.namePascal();
-    string methodReturn = "bool";
-    string methodParameters = "";
+    switch (messageFieldModel.fieldCategory())
+    {
+        case MessageFieldModel::FieldCategory::boolType:
+        case MessageFieldModel::FieldCategory::numericType:
+        case MessageFieldModel::FieldCategory::enumType:
+        case MessageFieldModel::FieldCategory::messageType:
+            break;
 
-    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, true);
+        default:
+            return;
+    }
 
-    string statement;
-    if (oneofModel != nullptr)
+    string fieldType = fullTypeName(messageFieldModel);
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
+
+    string methodName;
+    string methodReturn;
+    string methodParameters;
+    string statement;
+
+    // Booleans are stored as bytes so they do not get a view of their values.
+    if (messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::boolType)
     {
-        string oneofEnumClassName = oneofModel->namePascal() + "Choices";
-        string oneofEnumInstanceName = "mData->mCurrent";
-        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
+        methodName = messageFieldModel.name() + "Values";
+        methodReturn = mBaseClassesNamespace + "::ArrayView<";
+        methodReturn += fieldType + ">";
+        headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, true);
 
-        statement = oneofEnumInstanceName + " != " + oneofEnumClassName + "::" + messageFieldModel.name();
-        headerFileWriter.writeIfOpening(statement);
+        statement = "return mData->";
+        statement += fieldReadName(protoModel, messageModel, messageFieldModel) + ".values();";
+        headerFileWriter.writeLineIndented(statement);
 
-        statement = "return false;";
+        headerFileWriter.writeClassMethodInlineClosing();
+    }
+
+    if (messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::messageType)
+    {
+        statement = "template <typename InputIterator>";
         headerFileWriter.writeLineIndented(statement);
 
-        headerFileWriter.writeIfClosing();
-        headerFileWriter.writeBlankLine();
+        methodName = "add";
+        methodName += messageFieldModel.namePascal() + "Values";
+        methodReturn = "void";
+        methodParameters = "InputIterator first, InputIterator last";
+        headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+        writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+
+        statement = fieldValueName + ".addValues(first, last);";
+        headerFileWriter.writeLineIndented(statement);
+
+        headerFileWriter.writeClassMethodInlineClosing();
     }
 
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Value";
-    statement = "return ";
-    statement += fieldValueName + ".hasValue();";
+    methodName = "reserve";
+    methodReturn = "void";
+    methodName += messageFieldModel.namePascal();
+    methodParameters = "size_t count";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+
+    statement = fieldValueName + ".reserve(count);";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageFieldAddNewRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                          const MessageModel & messageModel,
+                                                                          const MessageFieldModel & messageFieldModel) const
+{
+    string fieldType = fullTypeName(messageFieldModel);
+    string methodName = "addNew";
+    methodName += messageFieldModel.namePascal();
+    string methodReturn = fieldType + " &";
+    string methodParameters = "";
+
+    switch (messageFieldModel.fieldCategory())
+    {
+        case MessageFieldModel::FieldCategory::messageType:
+        {
+            headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+
+            string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
+            string statement = "return ";
+            statement += fieldValueName + ".addNewValue();";
+            headerFileWriter.writeLineIndented(statement);
+
+            headerFileWriter.writeClassMethodInlineClosing();
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageFieldClearRepeatedToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                         const MessageModel & messageModel,
+                                                                         const MessageFieldModel & messageFieldModel) const
+{
+    string methodName = "clear";
+    methodName += messageFieldModel.namePascal();
+    string methodReturn = "void";
+    string methodParameters = "";
+
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
+    string statement = fieldValueName + ".clearValue();";
+
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+    writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageFieldHasToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                               const MessageModel & messageModel,
+                                                               const MessageFieldModel & messageFieldModel,
+                                                               const OneofModel * oneofModel) const
+{
+    string methodName = "has";
+    methodName += messageFieldModel.namePascal();
+    string methodReturn = "bool";
+    string methodParameters = "";
+
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, true);
+
+    string statement;
+    if (oneofModel != nullptr)
+    {
+        string oneofEnumClassName = oneofModel->namePascal() + "Choices";
+        string oneofEnumInstanceName = "mData->mCurrent";
+        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
+
+        statement = "return " + oneofEnumInstanceName + " == " + oneofEnumClassName + "::" + messageFieldModel.name() + ";";
+    }
+    else
+    {
+        int bitIndex = hasBitIndex(messageModel, messageFieldModel);
+        statement = "return (mData->" + hasBitWordName(bitIndex) + " & " + hasBitMask(bitIndex) + ") != 0;";
+    }
 
     headerFileWriter.writeLineIndented(statement);
 
@@ -964,6 +1417,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldHasToHeader (CodeWriter & head
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageFieldGetToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                               const MessageModel & messageModel,
                                                                const MessageFieldModel & messageFieldModel,
                                                                const OneofModel * oneofModel) const
 {
@@ -972,11 +1426,12 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldGetToHeader (CodeWriter & head
     string methodReturn = "";
     string methodParameters = "";
 
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Value";
+    string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, messageFieldModel);
+    string descriptorName = "mData->m" + messageFieldModel.namePascal() + "Descriptor";
     string statement = "return ";
     statement += fieldValueName + ".value();";
 
+    // A field that is not present reads as its default, which only the descriptor holds.
     switch (messageFieldModel.fieldCategory())
     {
         case MessageFieldModel::FieldCategory::boolType:
@@ -986,12 +1441,37 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldGetToHeader (CodeWriter & head
             methodReturn += fieldType;
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, true);
 
+            string defaultStatement = fieldAbsentCondition(messageModel, messageFieldModel, oneofModel);
+            headerFileWriter.writeIfOpening(defaultStatement);
+            defaultStatement = "return " + descriptorName + ".defaultValue;";
+            headerFileWriter.writeLineIndented(defaultStatement);
+            headerFileWriter.writeIfClosing();
+            headerFileWriter.writeBlankLine();
+
             headerFileWriter.writeLineIndented(statement);
             break;
         }
 
         case MessageFieldModel::FieldCategory::stringType:
         case MessageFieldModel::FieldCategory::bytesType:
+        {
+            methodReturn += "const ";
+            methodReturn += fieldType + " &";
+            headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, true);
+
+            string defaultStatement = fieldAbsentCondition(messageModel, messageFieldModel, oneofModel);
+            headerFileWriter.writeIfOpening(defaultStatement);
+            defaultStatement = "static const std::string defaultValue(" + descriptorName + ".defaultValue);";
+            headerFileWriter.writeLineIndented(defaultStatement);
+            defaultStatement = "return defaultValue;";
+            headerFileWriter.writeLineIndented(defaultStatement);
+            headerFileWriter.writeIfClosing();
+            headerFileWriter.writeBlankLine();
+
+            headerFileWriter.writeLineIndented(statement);
+            break;
+        }
+
         case MessageFieldModel::FieldCategory::messageType:
         {
             methodReturn += "const ";
@@ -1009,7 +1489,41 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldGetToHeader (CodeWriter & head
     headerFileWriter.writeClassMethodInlineClosing();
 }
 
+void Protocol::CodeGeneratorCPP::writeMessageFieldViewToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                const MessageModel & messageModel,
+                                                                const MessageFieldModel & messageFieldModel,
+                                                                const OneofModel * oneofModel) const
+{
+    if (messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::stringType &&
+        messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::bytesType)
+    {
+        return;
+    }
+
+    string methodName = messageFieldModel.name() + "View";
+    string methodReturn = mBaseClassesNamespace + "::ByteView";
+    string methodParameters = "";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters, true);
+
+    string statement = fieldAbsentCondition(messageModel, messageFieldModel, oneofModel);
+    headerFileWriter.writeIfOpening(statement);
+    string descriptorName = "mData->m" + messageFieldModel.namePascal() + "Descriptor";
+    statement = "return " + mBaseClassesNamespace + "::ByteView(" + descriptorName + ".defaultValue, std::strlen(";
+    statement += descriptorName + ".defaultValue));";
+    headerFileWriter.writeLineIndented(statement);
+    headerFileWriter.writeIfClosing();
+    headerFileWriter.writeBlankLine();
+
+    string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, messageFieldModel);
+    statement = "return ";
+    statement += fieldValueName + ".view();";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
 void Protocol::CodeGeneratorCPP::writeMessageFieldSetToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                               const MessageModel & messageModel,
                                                                const MessageFieldModel & messageFieldModel,
                                                                const OneofModel * oneofModel) const
 {
@@ -1019,8 +1533,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSetToHeader (CodeWriter & head
     string methodReturn = "void";
     string methodParameters = "";
 
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Value";
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
     string statement = fieldValueName + ".setValue(value);";
 
     switch (messageFieldModel.fieldCategory())
@@ -1031,8 +1544,12 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSetToHeader (CodeWriter & head
         {
             methodParameters += fieldType + " value";
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
             headerFileWriter.writeLineIndented(statement);
+            writeHasBitSetToHeader(headerFileWriter, messageModel, messageFieldModel);
+            writeOneofChoiceToHeader(headerFileWriter, messageFieldModel, oneofModel);
+            headerFileWriter.writeClassMethodInlineClosing();
             break;
         }
 
@@ -1040,34 +1557,35 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldSetToHeader (CodeWriter & head
         case MessageFieldModel::FieldCategory::bytesType:
         case MessageFieldModel::FieldCategory::messageType:
         {
-            methodParameters += "const ";
+            methodParameters = "const ";
             methodParameters += fieldType + " & value";
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+
+            headerFileWriter.writeLineIndented(statement);
+            writeHasBitSetToHeader(headerFileWriter, messageModel, messageFieldModel);
+            writeOneofChoiceToHeader(headerFileWriter, messageFieldModel, oneofModel);
+            headerFileWriter.writeClassMethodInlineClosing();
+
+            methodParameters = fieldType + " && value";
+            headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
+            statement = fieldValueName + ".setValue(std::move(value));";
             headerFileWriter.writeLineIndented(statement);
+            writeHasBitSetToHeader(headerFileWriter, messageModel, messageFieldModel);
+            writeOneofChoiceToHeader(headerFileWriter, messageFieldModel, oneofModel);
+            headerFileWriter.writeClassMethodInlineClosing();
             break;
         }
 
         default:
             break;
     }
-
-    if (oneofModel != nullptr)
-    {
-        headerFileWriter.writeBlankLine();
-
-        string oneofEnumClassName = oneofModel->namePascal() + "Choices";
-        string oneofEnumInstanceName = "mData->mCurrent";
-        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
-
-        statement = oneofEnumInstanceName + " = " + oneofEnumClassName + "::" + messageFieldModel.name() + ";";
-        headerFileWriter.writeLineIndented(statement);
-    }
-
-    headerFileWriter.writeClassMethodInlineClosing();
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageFieldCreateNewToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                     const MessageModel & messageModel,
                                                                      const MessageFieldModel & messageFieldModel,
                                                                      const OneofModel * oneofModel) const
 {
@@ -1082,9 +1600,10 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldCreateNewToHeader (CodeWriter
         case MessageFieldModel::FieldCategory::messageType:
         {
             headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+            writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+            writeHasBitSetToHeader(headerFileWriter, messageModel, messageFieldModel);
 
-            string fieldValueName = "mData->m";
-            fieldValueName += messageFieldModel.namePascal() + "Value";
+            string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
             string statement = "return ";
             statement += fieldValueName + ".createNewValue();";
             headerFileWriter.writeLineIndented(statement);
@@ -1110,7 +1629,94 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldCreateNewToHeader (CodeWriter
     }
 }
 
+void Protocol::CodeGeneratorCPP::writeMessageFieldMutableToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                   const MessageModel & messageModel,
+                                                                   const MessageFieldModel & messageFieldModel,
+                                                                   const OneofModel * oneofModel) const
+{
+    switch (messageFieldModel.fieldCategory())
+    {
+        case MessageFieldModel::FieldCategory::stringType:
+        case MessageFieldModel::FieldCategory::bytesType:
+        case MessageFieldModel::FieldCategory::messageType:
+            break;
+
+        default:
+            return;
+    }
+
+    string fieldType = fullTypeName(messageFieldModel);
+    string methodName = "mutable";
+    methodName += messageFieldModel.namePascal();
+    string methodReturn = fieldType + " &";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn);
+    writeMessageByteSizeInvalidationToHeader(headerFileWriter);
+
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
+
+    // A string that is not present starts from its default.
+    if (messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::messageType)
+    {
+        string statement = fieldAbsentCondition(messageModel, messageFieldModel, oneofModel);
+        headerFileWriter.writeIfOpening(statement);
+        statement = fieldValueName + ".setValue(mData->m" + messageFieldModel.namePascal() + "Descriptor.defaultValue);";
+        headerFileWriter.writeLineIndented(statement);
+        headerFileWriter.writeIfClosing();
+    }
+    writeHasBitSetToHeader(headerFileWriter, messageModel, messageFieldModel);
+
+    // The choice has to be set before returning so it is written first.
+    if (oneofModel != nullptr)
+    {
+        string oneofEnumClassName = oneofModel->namePascal() + "Choices";
+        string oneofEnumInstanceName = "mData->mCurrent";
+        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
+
+        string statement = oneofEnumInstanceName + " = " + oneofEnumClassName + "::" + messageFieldModel.name() + ";";
+        headerFileWriter.writeLineIndented(statement);
+        headerFileWriter.writeBlankLine();
+    }
+
+    string statement = "return ";
+    statement += fieldValueName + ".mutableValue();";
+    headerFileWriter.writeLineIndented(statement);
+
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
+void Protocol::CodeGeneratorCPP::writeHasBitSetToHeader (CodeWriter & headerFileWriter, const MessageModel & messageModel,
+                                                         const MessageFieldModel & messageFieldModel) const
+{
+    int bitIndex = hasBitIndex(messageModel, messageFieldModel);
+    if (bitIndex < 0)
+    {
+        return;
+    }
+
+    string statement = "mData->" + hasBitWordName(bitIndex) + " |= " + hasBitMask(bitIndex) + ";";
+    headerFileWriter.writeLineIndented(statement);
+}
+
+void Protocol::CodeGeneratorCPP::writeOneofChoiceToHeader (CodeWriter & headerFileWriter, const MessageFieldModel & messageFieldModel,
+                                                           const OneofModel * oneofModel) const
+{
+    if (oneofModel == nullptr)
+    {
+        return;
+    }
+
+    headerFileWriter.writeBlankLine();
+
+    string oneofEnumClassName = oneofModel->namePascal() + "Choices";
+    string oneofEnumInstanceName = "mData->mCurrent";
+    oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
+
+    string statement = oneofEnumInstanceName + " = " + oneofEnumClassName + "::" + messageFieldModel.name() + ";";
+    headerFileWriter.writeLineIndented(statement);
+}
+
 void Protocol::CodeGeneratorCPP::writeMessageFieldClearToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                                 const MessageModel & messageModel,
                                                                  const MessageFieldModel & messageFieldModel,
                                                                  const OneofModel * oneofModel) const
 {
@@ -1120,6 +1726,7 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldClearToHeader (CodeWriter & he
     string methodParameters = "";
 
     headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+    writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
     string statement;
     string oneofEnumClassName;
@@ -1140,11 +1747,17 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldClearToHeader (CodeWriter & he
         headerFileWriter.writeBlankLine();
     }
     
-    string fieldValueName = "mData->m";
-    fieldValueName += messageFieldModel.namePascal() + "Value";
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
     statement = fieldValueName + ".clearValue();";
     
     headerFileWriter.writeLineIndented(statement);
+
+    int bitIndex = hasBitIndex(messageModel, messageFieldModel);
+    if (bitIndex >= 0)
+    {
+        statement = "mData->" + hasBitWordName(bitIndex) + " &= ~" + hasBitMask(bitIndex) + ";";
+        headerFileWriter.writeLineIndented(statement);
+    }
     
     if (oneofModel != nullptr)
     {
@@ -1177,6 +1790,59 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldBackingFieldsToHeader (CodeWri
     }
 }
 
+void Protocol::CodeGeneratorCPP::writeMessageDataFieldCurrentToHeader (CodeWriter & headerFileWriter,
+                                                                       const MessageFieldModel & messageFieldModel) const
+{
+    string fieldType = fullTypeNameInternal(messageFieldModel);
+    string fieldValueName = "m";
+    fieldValueName += messageFieldModel.namePascal();
+    string methodName = "current";
+    methodName += messageFieldModel.namePascal();
+    string readMethodName = "read";
+    readMethodName += messageFieldModel.namePascal();
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        fieldValueName += "Collection";
+        methodName += "Collection";
+        readMethodName += "Collection";
+    }
+    else
+    {
+        fieldValueName += "Value";
+        methodName += "Value";
+        readMethodName += "Value";
+    }
+    string fieldEpochName = "m";
+    fieldEpochName += messageFieldModel.namePascal() + "Epoch";
+
+    string methodReturn = fieldType + " &";
+    headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn);
+    string statement = fieldEpochName + " != mEpoch";
+    headerFileWriter.writeIfOpening(statement);
+    statement = fieldValueName + ".clearValue();";
+    headerFileWriter.writeLineIndented(statement);
+    statement = fieldEpochName + " = mEpoch;";
+    headerFileWriter.writeLineIndented(statement);
+    headerFileWriter.writeIfClosing();
+    statement = "return " + fieldValueName + ";";
+    headerFileWriter.writeLineIndented(statement);
+    headerFileWriter.writeClassMethodInlineClosing();
+
+    // Const paths read through here so they never write to the data. A stale field reads as an empty one.
+    methodReturn = "const " + fieldType + " &";
+    headerFileWriter.writeClassMethodInlineOpening(readMethodName, methodReturn, true);
+    statement = fieldEpochName + " != mEpoch";
+    headerFileWriter.writeIfOpening(statement);
+    statement = "static const " + fieldType + " emptyValue;";
+    headerFileWriter.writeLineIndented(statement);
+    statement = "return emptyValue;";
+    headerFileWriter.writeLineIndented(statement);
+    headerFileWriter.writeIfClosing();
+    statement = "return " + fieldValueName + ";";
+    headerFileWriter.writeLineIndented(statement);
+    headerFileWriter.writeClassMethodInlineClosing();
+}
+
 void Protocol::CodeGeneratorCPP::writeMessageFieldIndexToHeader (CodeWriter & headerFileWriter,
                                                                  const MessageFieldModel & messageFieldModel) const
 {
@@ -1184,9 +1850,50 @@ void Protocol::CodeGeneratorCPP::writeMessageFieldIndexToHeader (CodeWriter & he
     constantName += messageFieldModel.namePascal() + "Index";
     string fieldType = "const unsigned int";
     headerFileWriter.writeClassFieldDeclaration(constantName, fieldType, to_string(messageFieldModel.index()), true);
+
+    string descriptorName = "m";
+    descriptorName += messageFieldModel.namePascal() + "Descriptor";
+    string descriptorType = "constexpr " + messageFieldDescriptorType(messageFieldModel);
+    string descriptorValue = "{" + constantName + ", " + to_string(fieldWireType(messageFieldModel)) + ", ";
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::required)
+    {
+        descriptorValue += "true, ";
+    }
+    else
+    {
+        descriptorValue += "false, ";
+    }
+    descriptorValue += messageFieldDefaultValue(messageFieldModel) + "}";
+    headerFileWriter.writeClassFieldDeclaration(descriptorName, descriptorType, descriptorValue, true);
+
+    // The encoded key is copied straight into the output instead of being encoded for every value written.
+    vector<unsigned char> tagBytes = fieldTagBytes(messageFieldModel);
+    string tagName = "m";
+    tagName += messageFieldModel.namePascal() + "Tag";
+    string tagValue = "{";
+    for (unsigned int tagIndex = 0; tagIndex < tagBytes.size(); ++tagIndex)
+    {
+        if (tagIndex != 0)
+        {
+            tagValue += ", ";
+        }
+        ostringstream tagByte;
+        tagByte << "'\\x" << hex << setw(2) << setfill('0') << static_cast<unsigned int>(tagBytes[tagIndex]) << "'";
+        tagValue += tagByte.str();
+    }
+    tagValue += "}";
+    headerFileWriter.writeClassFieldDeclaration(tagName + "[]", "constexpr char", tagValue, true);
+    headerFileWriter.writeClassFieldDeclaration(tagName + "Size", fieldType, to_string(tagBytes.size()), true);
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageByteSizeInvalidationToHeader (CodeWriter & headerFileWriter) const
+{
+    string statement = "mData->mContentByteSize.invalidate();";
+    headerFileWriter.writeLineIndented(statement);
 }
 
 void Protocol::CodeGeneratorCPP::writeOneofToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                                     const MessageModel & messageModel,
                                                      const OneofModel & oneofModel) const
 {
     string enumName = oneofModel.namePascal() + "Choices";
@@ -1220,7 +1927,7 @@ void Protocol::CodeGeneratorCPP::writeOneofToHeader (CodeWriter & headerFileWrit
     {
         auto messageFieldModel = *messageFieldBegin;
 
-        writeMessageOneofFieldToHeader(headerFileWriter, protoModel, *messageFieldModel, oneofModel);
+        writeMessageOneofFieldToHeader(headerFileWriter, protoModel, messageModel, *messageFieldModel, oneofModel);
 
         ++messageFieldBegin;
     }
@@ -1292,6 +1999,7 @@ void Protocol::CodeGeneratorCPP::writeMessageOneofClearToHeader (CodeWriter & he
     string methodReturn = "void";
     string methodParameters = "";
     headerFileWriter.writeClassMethodInlineOpening(methodName, methodReturn, methodParameters);
+    writeMessageByteSizeInvalidationToHeader(headerFileWriter);
 
     string oneofEnumClassName = oneofModel.namePascal() + "Choices";
     string oneofEnumInstanceName = "mData->mCurrent";
@@ -1340,8 +2048,17 @@ void Protocol::CodeGeneratorCPP::writeMessageToSource (CodeWriter & sourceFileWr
     }
     fullScope += className;
 
+    writeMessageFieldDescriptorsToSource(sourceFileWriter, messageModel, className, fullScope);
+
     writeMessageDataConstructorToSource(sourceFileWriter, protoModel, messageModel, className, fullScope);
 
+    writeMessageDataClearToSource(sourceFileWriter, protoModel, messageModel, className, fullScope);
+
+    if (optimizeForCodeSize(protoModel, messageModel))
+    {
+        writeMessageFieldTableToSource(sourceFileWriter, protoModel, messageModel, className, fullScope);
+    }
+
     writeMessageParseToSource(sourceFileWriter, protoModel, messageModel, className, fullScope);
 
     writeMessageSerializeToSource(sourceFileWriter, protoModel, messageModel, className, fullScope);
@@ -1351,6 +2068,43 @@ void Protocol::CodeGeneratorCPP::writeMessageToSource (CodeWriter & sourceFileWr
     writeMessageValidToSource(sourceFileWriter, protoModel, messageModel, className, fullScope);
 }
 
+void Protocol::CodeGeneratorCPP::writeMessageFieldDescriptorsToSource (CodeWriter & sourceFileWriter, const MessageModel & messageModel,
+                                                                       const std::string & className, const std::string & fullScope) const
+{
+    string fullDataScope = fullScope + "::";
+    fullDataScope += className + "Data";
+
+    // The descriptors and tags are used by reference, so they need a definition outside of the class.
+    vector<const MessageFieldModel *> fields;
+    for (auto & messageFieldModel: *messageModel.fields())
+    {
+        fields.push_back(messageFieldModel.get());
+    }
+    for (auto & oneofModel: *messageModel.oneofs())
+    {
+        for (auto & messageFieldModel: *oneofModel->fields())
+        {
+            fields.push_back(messageFieldModel.get());
+        }
+    }
+
+    for (auto messageFieldModel: fields)
+    {
+        string fieldName = fullDataScope + "::m" + messageFieldModel->namePascal() + "Descriptor";
+        string fieldType = "constexpr " + messageFieldDescriptorType(*messageFieldModel);
+        sourceFileWriter.writeStaticFieldDefinition(fieldName, fieldType);
+
+        fieldName = fullDataScope + "::m" + messageFieldModel->namePascal() + "Tag[]";
+        fieldType = "constexpr char";
+        sourceFileWriter.writeStaticFieldDefinition(fieldName, fieldType);
+    }
+
+    if (!fields.empty())
+    {
+        sourceFileWriter.writeBlankLine();
+    }
+}
+
 void Protocol::CodeGeneratorCPP::writeMessageDataConstructorToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                                                   const MessageModel & messageModel, const std::string & className,
                                                                   const std::string & fullScope) const
@@ -1359,84 +2113,138 @@ void Protocol::CodeGeneratorCPP::writeMessageDataConstructorToSource (CodeWriter
     string fullDataScope = fullScope + "::";
     fullDataScope += classDataName;
 
+    // Default values live in the field descriptors, so the fields themselves start out empty.
     string initializationParameters = "";
-    bool firstParameter = true;
+    auto oneofBegin = messageModel.oneofs()->cbegin();
+    auto oneofEnd = messageModel.oneofs()->cend();
+    while (oneofBegin != oneofEnd)
+    {
+        auto oneofModel = *oneofBegin;
+
+        string oneofEnumClassName = fullScope + "::" + oneofModel->namePascal() + "Choices";
+        string oneofEnumInstanceName = "mCurrent";
+        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
+
+        initializationParameters += oneofEnumInstanceName + "(" + oneofEnumClassName + "::none), ";
+
+        ++oneofBegin;
+    }
+
+    initializationParameters += "mArena(pArena)";
+
     auto messageFieldBegin = messageModel.fields()->cbegin();
     auto messageFieldEnd = messageModel.fields()->cend();
-    while (messageFieldBegin != messageFieldEnd)
+
+    if (hasBitWordCount(messageModel) != 0)
     {
-        auto messageFieldModel = *messageFieldBegin;
+        initializationParameters += ", mHasBits()";
+    }
+
+    if (epochPresence(protoModel, messageModel))
+    {
+        initializationParameters += ", mEpoch(0)";
+
+        messageFieldBegin = messageModel.fields()->cbegin();
+        messageFieldEnd = messageModel.fields()->cend();
+        while (messageFieldBegin != messageFieldEnd)
+        {
+            initializationParameters += ", m" + (*messageFieldBegin)->namePascal() + "Epoch(0)";
+
+            ++messageFieldBegin;
+        }
 
-        string fieldInitialization = messageFieldInitialization(*messageFieldModel);
-        if (!fieldInitialization.empty())
+        oneofBegin = messageModel.oneofs()->cbegin();
+        while (oneofBegin != oneofEnd)
         {
-            if (!firstParameter)
+            messageFieldBegin = (*oneofBegin)->fields()->cbegin();
+            messageFieldEnd = (*oneofBegin)->fields()->cend();
+            while (messageFieldBegin != messageFieldEnd)
             {
-                initializationParameters += ", ";
+                initializationParameters += ", m" + (*messageFieldBegin)->namePascal() + "Epoch(0)";
+
+                ++messageFieldBegin;
             }
-            firstParameter = false;
 
-            initializationParameters += fieldInitialization;
+            ++oneofBegin;
         }
+    }
+
+    string methodName = fullDataScope + "::" + classDataName;
+    string methodParameters = mBaseClassesNamespace + "::Arena * pArena";
+    sourceFileWriter.writeConstructorImplementationOpening(methodName, methodParameters, initializationParameters);
+
+    messageFieldBegin = messageModel.fields()->cbegin();
+    messageFieldEnd = messageModel.fields()->cend();
+    while (messageFieldBegin != messageFieldEnd)
+    {
+        auto messageFieldModel = *messageFieldBegin;
+
+        writeMessageDataFieldInitializationToSource(sourceFileWriter, protoModel, *messageFieldModel, classDataName, fullDataScope);
 
         ++messageFieldBegin;
     }
 
-    auto oneofBegin = messageModel.oneofs()->cbegin();
-    auto oneofEnd = messageModel.oneofs()->cend();
+    oneofBegin = messageModel.oneofs()->cbegin();
+    oneofEnd = messageModel.oneofs()->cend();
     while (oneofBegin != oneofEnd)
     {
         auto oneofModel = *oneofBegin;
 
-        if (!firstParameter)
-        {
-            initializationParameters += ", ";
-        }
-        firstParameter = false;
-
-        string oneofEnumClassName = fullScope + "::" + oneofModel->namePascal() + "Choices";
-        string oneofEnumInstanceName = "mCurrent";
-        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
-
-        initializationParameters += oneofEnumInstanceName + "(" + oneofEnumClassName + "::none)";
-
         messageFieldBegin = oneofModel->fields()->cbegin();
         messageFieldEnd = oneofModel->fields()->cend();
         while (messageFieldBegin != messageFieldEnd)
         {
             auto messageFieldModel = *messageFieldBegin;
 
-            string fieldInitialization = messageFieldInitialization(*messageFieldModel);
-            if (!fieldInitialization.empty())
-            {
-                initializationParameters += ", ";
+            writeMessageDataFieldInitializationToSource(sourceFileWriter, protoModel, *messageFieldModel, classDataName, fullDataScope);
 
-                initializationParameters += fieldInitialization;
-            }
-            
             ++messageFieldBegin;
         }
-
+        
         ++oneofBegin;
     }
 
-    string methodName = fullDataScope + "::" + classDataName;
+    sourceFileWriter.writeMethodImplementationClosing();
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageDataClearToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                            const MessageModel & messageModel, const std::string & className,
+                                                            const std::string & fullScope) const
+{
+    string classDataName = className + "Data";
+    string fullDataScope = fullScope + "::";
+    fullDataScope += classDataName;
+
+    string methodName = fullDataScope + "::clear";
+    string methodReturn = "void";
     string methodParameters = "";
-    sourceFileWriter.writeConstructorImplementationOpening(methodName, methodParameters, initializationParameters);
+    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters);
 
-    messageFieldBegin = messageModel.fields()->cbegin();
-    messageFieldEnd = messageModel.fields()->cend();
+    // With epoch presence, moving to the next epoch leaves every field stale and each one gets cleared when it is
+    // next used. The fields only need to be cleared here when the epoch wraps around back to where they started.
+    bool isEpoch = epochPresence(protoModel, messageModel);
+    string statement;
+    if (isEpoch)
+    {
+        statement = "++mEpoch;";
+        sourceFileWriter.writeLineIndented(statement);
+        statement = "mEpoch == 0";
+        sourceFileWriter.writeIfOpening(statement);
+    }
+
+    auto messageFieldBegin = messageModel.fields()->cbegin();
+    auto messageFieldEnd = messageModel.fields()->cend();
     while (messageFieldBegin != messageFieldEnd)
     {
         auto messageFieldModel = *messageFieldBegin;
 
-        writeMessageDataFieldInitializationToSource(sourceFileWriter, protoModel, *messageFieldModel, classDataName, fullDataScope);
+        writeMessageDataFieldClearToSource(sourceFileWriter, *messageFieldModel, isEpoch);
 
         ++messageFieldBegin;
     }
 
-    oneofBegin = messageModel.oneofs()->cbegin();
-    oneofEnd = messageModel.oneofs()->cend();
+    auto oneofBegin = messageModel.oneofs()->cbegin();
+    auto oneofEnd = messageModel.oneofs()->cend();
     while (oneofBegin != oneofEnd)
     {
         auto oneofModel = *oneofBegin;
@@ -1447,17 +2255,74 @@ void Protocol::CodeGeneratorCPP::writeMessageDataConstructorToSource (CodeWriter
         {
             auto messageFieldModel = *messageFieldBegin;
 
-            writeMessageDataFieldInitializationToSource(sourceFileWriter, protoModel, *messageFieldModel, classDataName, fullDataScope);
+            writeMessageDataFieldClearToSource(sourceFileWriter, *messageFieldModel, isEpoch);
 
             ++messageFieldBegin;
         }
-        
+
         ++oneofBegin;
     }
 
+    if (isEpoch)
+    {
+        sourceFileWriter.writeIfClosing();
+    }
+
+    unsigned int wordCount = hasBitWordCount(messageModel);
+    for (unsigned int wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+    {
+        statement = hasBitWordName(static_cast<int>(wordIndex * 32)) + " = 0;";
+        sourceFileWriter.writeLineIndented(statement);
+    }
+
+    oneofBegin = messageModel.oneofs()->cbegin();
+    while (oneofBegin != oneofEnd)
+    {
+        auto oneofModel = *oneofBegin;
+
+        string oneofEnumClassName = fullScope + "::" + oneofModel->namePascal() + "Choices";
+        string oneofEnumInstanceName = "mCurrent";
+        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
+
+        statement = oneofEnumInstanceName + " = " + oneofEnumClassName + "::none;";
+        sourceFileWriter.writeLineIndented(statement);
+
+        ++oneofBegin;
+    }
+
+    statement = "mUnknownFields.clear();";
+    sourceFileWriter.writeLineIndented(statement);
+    statement = "mContentByteSize.invalidate();";
+    sourceFileWriter.writeLineIndented(statement);
+
     sourceFileWriter.writeMethodImplementationClosing();
 }
 
+void Protocol::CodeGeneratorCPP::writeMessageDataFieldClearToSource (CodeWriter & sourceFileWriter,
+                                                                 const MessageFieldModel & messageFieldModel,
+                                                                 bool resetEpoch) const
+{
+    string fieldValueName = "m";
+    fieldValueName += messageFieldModel.namePascal();
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        fieldValueName += "Collection";
+    }
+    else
+    {
+        fieldValueName += "Value";
+    }
+
+    string statement = fieldValueName + ".clearValue();";
+    sourceFileWriter.writeLineIndented(statement);
+
+    if (resetEpoch)
+    {
+        statement = "m" + messageFieldModel.namePascal() + "Epoch = 0;";
+        sourceFileWriter.writeLineIndented(statement);
+    }
+}
+
 void Protocol::CodeGeneratorCPP::writeMessageDataFieldInitializationToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                                                               const MessageFieldModel & messageFieldModel, const std::string & className,
                                                                               const std::string & fullScope) const
@@ -1478,66 +2343,347 @@ void Protocol::CodeGeneratorCPP::writeMessageDataFieldInitializationToSource (Co
 
     string statement = fieldValueName + ".setIndex(" + fieldIndexName + ");";
     sourceFileWriter.writeLineIndented(statement);
+
+    bool arenaField = messageFieldModel.fieldCategory() == MessageFieldModel::FieldCategory::messageType;
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated &&
+        (messageFieldModel.fieldCategory() == MessageFieldModel::FieldCategory::stringType ||
+         messageFieldModel.fieldCategory() == MessageFieldModel::FieldCategory::bytesType))
+    {
+        arenaField = true;
+    }
+    if (arenaField)
+    {
+        statement = fieldValueName + ".setArena(pArena);";
+        sourceFileWriter.writeLineIndented(statement);
+    }
 }
 
-std::string Protocol::CodeGeneratorCPP::messageFieldInitialization (const MessageFieldModel & messageFieldModel) const
+std::string Protocol::CodeGeneratorCPP::messageFieldDescriptorType (const MessageFieldModel & messageFieldModel) const
 {
-    string fieldInitialization;
-
-    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    string defaultType = mBaseClassesNamespace + "::NoDefault";
+    if (messageFieldModel.requiredness() != MessageFieldModel::Requiredness::repeated)
     {
-        fieldInitialization = "m" + messageFieldModel.namePascal() + "Collection";
+        switch (messageFieldModel.fieldCategory())
+        {
+            case MessageFieldModel::FieldCategory::boolType:
+            case MessageFieldModel::FieldCategory::numericType:
+            case MessageFieldModel::FieldCategory::enumType:
+                defaultType = fullTypeName(messageFieldModel);
+                break;
+
+            case MessageFieldModel::FieldCategory::stringType:
+            case MessageFieldModel::FieldCategory::bytesType:
+                defaultType = "const char *";
+                break;
+
+            default:
+                break;
+        }
     }
-    else
+
+    return mBaseClassesNamespace + "::FieldDescriptor<" + defaultType + ">";
+}
+
+std::string Protocol::CodeGeneratorCPP::messageFieldDefaultValue (const MessageFieldModel & messageFieldModel) const
+{
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
     {
-        fieldInitialization = "m" + messageFieldModel.namePascal() + "Value";
+        return "{}";
     }
 
     switch (messageFieldModel.fieldCategory())
     {
         case MessageFieldModel::FieldCategory::boolType:
-        case MessageFieldModel::FieldCategory::numericType:
         {
             if (messageFieldModel.defaultValue().empty())
             {
-                return "";
+                return "false";
             }
-            fieldInitialization += "(" + messageFieldModel.defaultValue() + ")";
-            break;
+            return messageFieldModel.defaultValue();
         }
 
-        case MessageFieldModel::FieldCategory::enumType:
+        case MessageFieldModel::FieldCategory::numericType:
         {
             if (messageFieldModel.defaultValue().empty())
             {
-                return "";
+                return "0";
             }
-            string defaultValue = fullTypeName(messageFieldModel) + "::" + messageFieldModel.defaultValue();
-            fieldInitialization += "(" + defaultValue + ")";
-            break;
+            return messageFieldModel.defaultValue();
         }
 
-        case MessageFieldModel::FieldCategory::stringType:
+        case MessageFieldModel::FieldCategory::enumType:
         {
             if (messageFieldModel.defaultValue().empty())
             {
-                return "";
+                return "static_cast<" + fullTypeName(messageFieldModel) + ">(0)";
             }
-            fieldInitialization += "(\"" + messageFieldModel.defaultValue() + "\")";
-            break;
+            return fullTypeName(messageFieldModel) + "::" + messageFieldModel.defaultValue();
         }
 
+        case MessageFieldModel::FieldCategory::stringType:
         case MessageFieldModel::FieldCategory::bytesType:
-        case MessageFieldModel::FieldCategory::messageType:
         {
-            return "";
+            return "\"" + messageFieldModel.defaultValue() + "\"";
         }
 
         default:
-            break;
+            return "{}";
+    }
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageFieldTableToHeader (CodeWriter & headerFileWriter, const MessageModel & messageModel) const
+{
+    string fieldName = "mFieldTable";
+    string fieldType = "const " + mBaseClassesNamespace + "::FieldTable";
+    headerFileWriter.writeClassFieldDeclaration(fieldName, fieldType, true);
+
+    if (messageModel.fields()->empty() && messageModel.oneofs()->empty())
+    {
+        headerFileWriter.writeBlankLine();
+        return;
+    }
+
+    fieldName = "mFieldEntries[]";
+    fieldType = "const " + mBaseClassesNamespace + "::FieldTableEntry";
+    headerFileWriter.writeClassFieldDeclaration(fieldName, fieldType, true);
+
+    if (fieldTableDenseCount(messageModel) != 0)
+    {
+        fieldName = "mFieldDenseLookup[]";
+        fieldType = "const unsigned short";
+        headerFileWriter.writeClassFieldDeclaration(fieldName, fieldType, true);
+    }
+
+    headerFileWriter.writeBlankLine();
+
+    string methodReturn = mBaseClassesNamespace + "::ProtoBase *";
+    string methodParameters = "void * pMessageData";
+
+    auto messageFieldBegin = messageModel.fields()->cbegin();
+    auto messageFieldEnd = messageModel.fields()->cend();
+    while (messageFieldBegin != messageFieldEnd)
+    {
+        auto messageFieldModel = *messageFieldBegin;
+
+        string methodName = "field" + messageFieldModel->namePascal();
+        headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, false, false, true);
+
+        if (hasBitIndex(messageModel, *messageFieldModel) >= 0)
+        {
+            methodName = "select" + messageFieldModel->namePascal();
+            headerFileWriter.writeClassMethodDeclaration(methodName, "void", methodParameters, false, false, true);
+        }
+
+        ++messageFieldBegin;
+    }
+
+    auto oneofBegin = messageModel.oneofs()->cbegin();
+    auto oneofEnd = messageModel.oneofs()->cend();
+    while (oneofBegin != oneofEnd)
+    {
+        auto oneofModel = *oneofBegin;
+
+        messageFieldBegin = oneofModel->fields()->cbegin();
+        messageFieldEnd = oneofModel->fields()->cend();
+        while (messageFieldBegin != messageFieldEnd)
+        {
+            auto messageFieldModel = *messageFieldBegin;
+
+            string methodName = "field" + messageFieldModel->namePascal();
+            headerFileWriter.writeClassMethodDeclaration(methodName, methodReturn, methodParameters, false, false, true);
+
+            methodName = "select" + messageFieldModel->namePascal();
+            headerFileWriter.writeClassMethodDeclaration(methodName, "void", methodParameters, false, false, true);
+
+            ++messageFieldBegin;
+        }
+
+        ++oneofBegin;
+    }
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageFieldTableToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                                 const MessageModel & messageModel, const std::string & className,
+                                                                 const std::string & fullScope) const
+{
+    string classDataName = className + "Data";
+    string fullDataScope = fullScope + "::";
+    fullDataScope += classDataName;
+
+    // Each entry holds the field and the oneof it belongs to, if any.
+    vector<pair<const MessageFieldModel *, const OneofModel *>> entries;
+
+    auto messageFieldBegin = messageModel.fields()->cbegin();
+    auto messageFieldEnd = messageModel.fields()->cend();
+    while (messageFieldBegin != messageFieldEnd)
+    {
+        entries.emplace_back(messageFieldBegin->get(), nullptr);
+
+        ++messageFieldBegin;
+    }
+
+    auto oneofBegin = messageModel.oneofs()->cbegin();
+    auto oneofEnd = messageModel.oneofs()->cend();
+    while (oneofBegin != oneofEnd)
+    {
+        auto oneofModel = *oneofBegin;
+
+        messageFieldBegin = oneofModel->fields()->cbegin();
+        messageFieldEnd = oneofModel->fields()->cend();
+        while (messageFieldBegin != messageFieldEnd)
+        {
+            entries.emplace_back(messageFieldBegin->get(), oneofModel.get());
+
+            ++messageFieldBegin;
+        }
+
+        ++oneofBegin;
+    }
+
+    sort(entries.begin(), entries.end(),
+         [] (const pair<const MessageFieldModel *, const OneofModel *> & lhs, const pair<const MessageFieldModel *, const OneofModel *> & rhs)
+         {
+             return lhs.first->index() < rhs.first->index();
+         });
+
+    string statement;
+    string methodReturn = mBaseClassesNamespace + "::ProtoBase *";
+    string methodParameters = "void * pMessageData";
+    for (auto & entry: entries)
+    {
+        const MessageFieldModel & messageFieldModel = *entry.first;
+
+        string fieldValueName = fieldStorageName(protoModel, messageModel, messageFieldModel);
+
+        string methodName = fullDataScope + "::field" + messageFieldModel.namePascal();
+        sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters);
+
+        statement = "return &static_cast<" + classDataName + " *>(pMessageData)->" + fieldValueName + ";";
+        sourceFileWriter.writeLineIndented(statement);
+
+        sourceFileWriter.writeMethodImplementationClosing();
+
+        if (entry.second != nullptr)
+        {
+            string oneofEnumClassName = fullScope + "::" + entry.second->namePascal() + "Choices";
+            string oneofEnumInstanceName = "mCurrent";
+            oneofEnumInstanceName += entry.second->namePascal() + "Choice";
+
+            methodName = fullDataScope + "::select" + messageFieldModel.namePascal();
+            sourceFileWriter.writeMethodImplementationOpening(methodName, "void", methodParameters);
+
+            statement = "static_cast<" + classDataName + " *>(pMessageData)->" + oneofEnumInstanceName + " = ";
+            statement += oneofEnumClassName + "::" + messageFieldModel.name() + ";";
+            sourceFileWriter.writeLineIndented(statement);
+
+            sourceFileWriter.writeMethodImplementationClosing();
+        }
+        else if (hasBitIndex(messageModel, messageFieldModel) >= 0)
+        {
+            int bitIndex = hasBitIndex(messageModel, messageFieldModel);
+
+            methodName = fullDataScope + "::select" + messageFieldModel.namePascal();
+            sourceFileWriter.writeMethodImplementationOpening(methodName, "void", methodParameters);
+
+            statement = "static_cast<" + classDataName + " *>(pMessageData)->" + hasBitWordName(bitIndex) + " |= " + hasBitMask(bitIndex) + ";";
+            sourceFileWriter.writeLineIndented(statement);
+
+            sourceFileWriter.writeMethodImplementationClosing();
+        }
+    }
+
+    unsigned int denseCount = fieldTableDenseCount(messageModel);
+    if (!entries.empty())
+    {
+        string fieldName = fullDataScope + "::mFieldEntries[]";
+        string fieldType = "const " + mBaseClassesNamespace + "::FieldTableEntry";
+        sourceFileWriter.writeStaticFieldDefinitionOpening(fieldName, fieldType);
+
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            const MessageFieldModel & messageFieldModel = *entries[i].first;
+
+            statement = "{";
+            statement += to_string(messageFieldModel.index()) + ", ";
+            statement += to_string(fieldWireType(messageFieldModel)) + ", ";
+            statement += mBaseClassesNamespace + "::FieldKind::" + fieldKindName(messageFieldModel) + ", ";
+            statement += "&" + fullDataScope + "::field" + messageFieldModel.namePascal() + ", ";
+            if (entries[i].second != nullptr || hasBitIndex(messageModel, messageFieldModel) >= 0)
+            {
+                statement += "&" + fullDataScope + "::select" + messageFieldModel.namePascal() + "}";
+            }
+            else
+            {
+                statement += "nullptr}";
+            }
+            if (i + 1 != entries.size())
+            {
+                statement += ",";
+            }
+            sourceFileWriter.writeLineIndented(statement);
+        }
+
+        sourceFileWriter.writeStaticFieldDefinitionClosing();
+
+        if (denseCount != 0)
+        {
+            vector<size_t> denseLookup(denseCount, 0);
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                denseLookup[entries[i].first->index()] = i + 1;
+            }
+
+            fieldName = fullDataScope + "::mFieldDenseLookup[]";
+            fieldType = "const unsigned short";
+            sourceFileWriter.writeStaticFieldDefinitionOpening(fieldName, fieldType);
+
+            statement = "";
+            for (size_t i = 0; i < denseLookup.size(); ++i)
+            {
+                statement += to_string(denseLookup[i]);
+                if (i + 1 != denseLookup.size())
+                {
+                    statement += ",";
+                    if ((i + 1) % 16 == 0)
+                    {
+                        sourceFileWriter.writeLineIndented(statement);
+                        statement = "";
+                    }
+                    else
+                    {
+                        statement += " ";
+                    }
+                }
+            }
+            sourceFileWriter.writeLineIndented(statement);
+
+            sourceFileWriter.writeStaticFieldDefinitionClosing();
+        }
     }
 
-    return fieldInitialization;
+    string fieldName = fullDataScope + "::mFieldTable";
+    string fieldType = "const " + mBaseClassesNamespace + "::FieldTable";
+    sourceFileWriter.writeStaticFieldDefinitionOpening(fieldName, fieldType);
+
+    if (entries.empty())
+    {
+        statement = "nullptr, 0, nullptr, 0";
+    }
+    else
+    {
+        statement = fullDataScope + "::mFieldEntries, " + to_string(entries.size()) + ", ";
+        if (denseCount != 0)
+        {
+            statement += fullDataScope + "::mFieldDenseLookup, " + to_string(denseCount);
+        }
+        else
+        {
+            statement += "nullptr, 0";
+        }
+    }
+    sourceFileWriter.writeLineIndented(statement);
+
+    sourceFileWriter.writeStaticFieldDefinitionClosing();
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageParseToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
@@ -1546,10 +2692,59 @@ void Protocol::CodeGeneratorCPP::writeMessageParseToSource (CodeWriter & sourceF
 {
     string methodName = fullScope + "::parse";
     string methodReturn = "size_t";
-    string methodParameters = "const char * pData";
+    string methodParameters = "const char * pData, size_t available";
     sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters);
 
-    string statement = "pData == nullptr";
+    string statement = "return parseMessage(pData, available, false);";
+    sourceFileWriter.writeLineIndented(statement);
+
+    sourceFileWriter.writeMethodImplementationClosing();
+
+    methodName = fullScope + "::parseAliased";
+    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters);
+
+    statement = "return parseMessage(pData, available, true);";
+    sourceFileWriter.writeLineIndented(statement);
+
+    sourceFileWriter.writeMethodImplementationClosing();
+
+    methodName = fullScope + "::parseMessage";
+    methodParameters = "const char * pData, size_t available, bool aliased";
+    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters);
+
+    writeMessageDataRestore(sourceFileWriter, protoModel, messageModel, className);
+
+    if (optimizeForCodeSize(protoModel, messageModel))
+    {
+        statement = "mData->mContentByteSize.invalidate();";
+        sourceFileWriter.writeLineIndented(statement);
+
+        sourceFileWriter.writeBlankLine();
+
+        statement = "return " + mBaseClassesNamespace + "::FieldTableParser::parse(";
+        statement += className + "Data::mFieldTable, mData.get(), pData, available, aliased, &mData->mUnknownFields);";
+        sourceFileWriter.writeLineIndented(statement);
+
+        sourceFileWriter.writeMethodImplementationClosing();
+
+        methodName = fullScope + "::parseField";
+        methodParameters = "std::uint32_t fieldKey, const char * pData, size_t available, bool aliased";
+        sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters);
+
+        statement = "mData->mContentByteSize.invalidate();";
+        sourceFileWriter.writeLineIndented(statement);
+
+        sourceFileWriter.writeBlankLine();
+
+        statement = "return " + mBaseClassesNamespace + "::FieldTableParser::parseField(";
+        statement += className + "Data::mFieldTable, mData.get(), fieldKey, pData, available, aliased, &mData->mUnknownFields);";
+        sourceFileWriter.writeLineIndented(statement);
+
+        sourceFileWriter.writeMethodImplementationClosing();
+        return;
+    }
+
+    statement = "pData == nullptr";
     sourceFileWriter.writeIfOpening(statement);
     statement = "throw std::invalid_argument(\"pData cannot be null.\");";
     sourceFileWriter.writeLineIndented(statement);
@@ -1559,39 +2754,99 @@ void Protocol::CodeGeneratorCPP::writeMessageParseToSource (CodeWriter & sourceF
 
     statement = "size_t lengthBytesParsed = 0;";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "std::uint32_t length = MuddledManaged::Protocol::PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);";
+    statement = "std::uint32_t length = MuddledManaged::Protocol::PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);";
     sourceFileWriter.writeLineIndented(statement);
     statement = "pData += lengthBytesParsed;";
     sourceFileWriter.writeLineIndented(statement);
 
     sourceFileWriter.writeBlankLine();
 
+    statement = "length > available - lengthBytesParsed";
+    sourceFileWriter.writeIfOpening(statement);
+    statement = "throw MuddledManaged::Protocol::ProtocolBufferException(\"Message length exceeds available data.\");";
+    sourceFileWriter.writeLineIndented(statement);
+    sourceFileWriter.writeIfClosing();
+
+    sourceFileWriter.writeBlankLine();
+
+    statement = "mData->mContentByteSize.invalidate();";
+    sourceFileWriter.writeLineIndented(statement);
+
+    sourceFileWriter.writeBlankLine();
+
     statement = "std::uint32_t remainingBytes = length;";
     sourceFileWriter.writeLineIndented(statement);
+    if (!messageModel.fields()->empty() || !messageModel.oneofs()->empty())
+    {
+        statement = "unsigned int expectedField = 0;";
+        sourceFileWriter.writeLineIndented(statement);
+    }
     statement = "remainingBytes";
     sourceFileWriter.writeWhileLoopOpening(statement);
 
-    statement = "size_t fieldKeyBytesParsed = 0;";
-    sourceFileWriter.writeLineIndented(statement);
-    statement = "std::uint32_t fieldKey = MuddledManaged::Protocol::PrimitiveEncoding::parseVariableUnsignedInt32(pData, &fieldKeyBytesParsed);";
+    writeMessageParsePredictionToSource(sourceFileWriter, protoModel, messageModel, className);
+
+    statement = "fieldBytesParsed > remainingBytes";
+    sourceFileWriter.writeIfOpening(statement);
+    statement = "throw MuddledManaged::Protocol::ProtocolBufferException(\"Field exceeds available data.\");";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "pData += fieldKeyBytesParsed;";
+    sourceFileWriter.writeIfClosing();
+
+    sourceFileWriter.writeBlankLine();
+    statement = "pData += fieldBytesParsed;";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "remainingBytes -= fieldKeyBytesParsed;";
+    statement = "remainingBytes -= fieldBytesParsed;";
     sourceFileWriter.writeLineIndented(statement);
 
-    sourceFileWriter.writeBlankLine();
+    sourceFileWriter.writeWhileLoopClosing();
 
-    statement = "std::uint32_t fieldIndex = fieldKey >> 3;";
+    statement = "return lengthBytesParsed + length;";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "std::uint32_t fieldWireType = fieldKey & 0x07;";
+
+    sourceFileWriter.writeMethodImplementationClosing();
+
+    // Only string, bytes, and message fields can refer to the input, so the flag goes unnamed without them.
+    bool aliasedUsed = false;
+    vector<const MessageFieldModel *> parsedFields;
+    for (auto & field: *messageModel.fields())
+    {
+        parsedFields.push_back(field.get());
+    }
+    for (auto & oneof: *messageModel.oneofs())
+    {
+        for (auto & field: *oneof->fields())
+        {
+            parsedFields.push_back(field.get());
+        }
+    }
+    for (auto field: parsedFields)
+    {
+        if (field->fieldCategory() == MessageFieldModel::FieldCategory::stringType ||
+            field->fieldCategory() == MessageFieldModel::FieldCategory::bytesType ||
+            field->fieldCategory() == MessageFieldModel::FieldCategory::messageType)
+        {
+            aliasedUsed = true;
+        }
+    }
+
+    methodName = fullScope + "::parseField";
+    methodParameters = "std::uint32_t fieldKey, const char * pData, size_t available, bool";
+    if (aliasedUsed)
+    {
+        methodParameters += " aliased";
+    }
+    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters);
+
+    statement = "mData->mContentByteSize.invalidate();";
     sourceFileWriter.writeLineIndented(statement);
 
     sourceFileWriter.writeBlankLine();
 
+    // The whole key is matched so that a field that arrives with a different wire type than expected goes to the
+    // unknown fields, just like it does for the field table parser.
     statement = "size_t fieldBytesParsed = 0;";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "fieldIndex";
+    statement = "fieldKey";
     sourceFileWriter.writeSwitchOpening(statement);
 
     auto messageFieldBegin = messageModel.fields()->cbegin();
@@ -1600,25 +2855,12 @@ void Protocol::CodeGeneratorCPP::writeMessageParseToSource (CodeWriter & sourceF
     {
         auto messageFieldModel = *messageFieldBegin;
 
-        string fieldIndexName = className + "Data::m";
-        fieldIndexName += messageFieldModel->namePascal() + "Index";
+        string fieldKeyName = "(" + className + "Data::m";
+        fieldKeyName += messageFieldModel->namePascal() + "Index << 3) | " + to_string(fieldWireType(*messageFieldModel));
 
-        sourceFileWriter.writeSwitchCaseOpening(fieldIndexName);
+        sourceFileWriter.writeSwitchCaseOpening(fieldKeyName);
 
-        string fieldValueName = "mData->m";
-        fieldValueName += messageFieldModel->namePascal();
-        if (messageFieldModel->requiredness() == MessageFieldModel::Requiredness::repeated)
-        {
-            fieldValueName += "Collection";
-        }
-        else
-        {
-            fieldValueName += "Value";
-        }
-
-        statement = "fieldBytesParsed = ";
-        statement += fieldValueName + ".parse(pData);";
-        sourceFileWriter.writeLineIndented(statement);
+        writeMessageFieldParseCaseToSource(sourceFileWriter, protoModel, messageModel, *messageFieldModel, nullptr, "available");
 
         sourceFileWriter.writeSwitchCaseClosing();
 
@@ -1633,39 +2875,19 @@ void Protocol::CodeGeneratorCPP::writeMessageParseToSource (CodeWriter & sourceF
     {
         auto oneofModel = *oneofBegin;
 
-        string oneofEnumClassName = oneofModel->namePascal() + "Choices";
-        string oneofEnumInstanceName = "mData->mCurrent";
-        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
-
         messageFieldBegin = oneofModel->fields()->cbegin();
         messageFieldEnd = oneofModel->fields()->cend();
         while (messageFieldBegin != messageFieldEnd)
         {
             auto messageFieldModel = *messageFieldBegin;
 
-            string fieldIndexName = className + "Data::m";
-            fieldIndexName += messageFieldModel->namePascal() + "Index";
-
-            sourceFileWriter.writeSwitchCaseOpening(fieldIndexName);
-
-            string fieldValueName = "mData->m";
-            fieldValueName += messageFieldModel->namePascal();
-            if (messageFieldModel->requiredness() == MessageFieldModel::Requiredness::repeated)
-            {
-                fieldValueName += "Collection";
-            }
-            else
-            {
-                fieldValueName += "Value";
-            }
+            string fieldKeyName = "(" + className + "Data::m";
+            fieldKeyName += messageFieldModel->namePascal() + "Index << 3) | " + to_string(fieldWireType(*messageFieldModel));
 
-            statement = "fieldBytesParsed = ";
-            statement += fieldValueName + ".parse(pData);";
-            sourceFileWriter.writeLineIndented(statement);
+            sourceFileWriter.writeSwitchCaseOpening(fieldKeyName);
 
-            statement = oneofEnumInstanceName + " = ";
-            statement += oneofEnumClassName + "::" + messageFieldModel->name() + ";";
-            sourceFileWriter.writeLineIndented(statement);
+            writeMessageFieldParseCaseToSource(sourceFileWriter, protoModel, messageModel, *messageFieldModel,
+                                               oneofModel.get(), "available");
 
             sourceFileWriter.writeSwitchCaseClosing();
             
@@ -1678,63 +2900,247 @@ void Protocol::CodeGeneratorCPP::writeMessageParseToSource (CodeWriter & sourceF
     }
 
     sourceFileWriter.writeSwitchDefaultCaseOpening();
-    statement = "fieldWireType";
-    sourceFileWriter.writeSwitchOpening(statement);
-
-    statement = "0";
-    sourceFileWriter.writeSwitchCaseOpening(statement);
-    statement = "MuddledManaged::Protocol::PrimitiveEncoding::parseVariableUnsignedInt64(pData, &fieldBytesParsed);";
+    statement = "fieldBytesParsed = MuddledManaged::Protocol::UnknownFields::parse(fieldKey, pData, available, &mData->mUnknownFields);";
     sourceFileWriter.writeLineIndented(statement);
     sourceFileWriter.writeSwitchCaseClosing();
 
-    statement = "1";
-    sourceFileWriter.writeSwitchCaseOpening(statement);
-    statement = "fieldBytesParsed = 8;";
-    sourceFileWriter.writeLineIndented(statement);
-    sourceFileWriter.writeSwitchCaseClosing();
+    sourceFileWriter.writeSwitchClosing();
+
+    sourceFileWriter.writeBlankLine();
 
-    statement = "2";
-    sourceFileWriter.writeSwitchCaseOpening(statement);
-    statement = "size_t fieldLengthBytesParsed = 0;";
+    statement = "return fieldBytesParsed;";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "std::uint32_t fieldLength = MuddledManaged::Protocol::PrimitiveEncoding::parseVariableUnsignedInt32(pData, &fieldLengthBytesParsed);";
+
+    sourceFileWriter.writeMethodImplementationClosing();
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageFieldParseCaseToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                                     const MessageModel & messageModel,
+                                                                     const MessageFieldModel & messageFieldModel,
+                                                                     const OneofModel * pOneofModel,
+                                                                     const std::string & availableName) const
+{
+    string fieldValueName = "mData->" + fieldStorageName(protoModel, messageModel, messageFieldModel);
+
+    writeMessageFieldParseToSource(sourceFileWriter, messageFieldModel, fieldValueName, availableName);
+
+    string statement;
+    if (pOneofModel != nullptr)
+    {
+        statement = "mData->mCurrent" + pOneofModel->namePascal() + "Choice = ";
+        statement += pOneofModel->namePascal() + "Choices::" + messageFieldModel.name() + ";";
+        sourceFileWriter.writeLineIndented(statement);
+        return;
+    }
+
+    int bitIndex = hasBitIndex(messageModel, messageFieldModel);
+    if (bitIndex >= 0)
+    {
+        statement = "mData->" + hasBitWordName(bitIndex) + " |= " + hasBitMask(bitIndex) + ";";
+        sourceFileWriter.writeLineIndented(statement);
+    }
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageParsePredictionToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                                      const MessageModel & messageModel,
+                                                                      const std::string & className) const
+{
+    // Fields are predicted in the order writeTo puts them: the plain fields and then each oneof.
+    vector<pair<const MessageFieldModel *, const OneofModel *>> orderedFields;
+    vector<unsigned int> nextFields;
+    for (auto & field: *messageModel.fields())
+    {
+        orderedFields.emplace_back(field.get(), nullptr);
+        nextFields.push_back(static_cast<unsigned int>(orderedFields.size()));
+    }
+    for (auto & oneof: *messageModel.oneofs())
+    {
+        // Only one choice of a oneof is ever written, so every choice is followed by whatever comes after the oneof.
+        for (auto & field: *oneof->fields())
+        {
+            orderedFields.emplace_back(field.get(), oneof.get());
+        }
+        nextFields.resize(orderedFields.size(), static_cast<unsigned int>(orderedFields.size()));
+    }
+
+    string statement = "size_t fieldBytesParsed = 0;";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "fieldBytesParsed = fieldLengthBytesParsed + fieldLength;";
+    statement = "bool fieldPredicted = false;";
     sourceFileWriter.writeLineIndented(statement);
-    sourceFileWriter.writeSwitchCaseClosing();
 
-    statement = "5";
-    sourceFileWriter.writeSwitchCaseOpening(statement);
-    statement = "fieldBytesParsed = 4;";
-    sourceFileWriter.writeLineIndented(statement);
-    sourceFileWriter.writeSwitchCaseClosing();
+    sourceFileWriter.writeBlankLine();
 
-    sourceFileWriter.writeSwitchClosing();
-    sourceFileWriter.writeSwitchCaseClosing();
+    // Our own serializers write fields in order, so the tag of the next field is compared as raw bytes before
+    // falling back to decoding the field key. A tag that can repeat, or another choice of the same oneof, is tried
+    // next by falling through to the following case.
+    if (!orderedFields.empty())
+    {
+        statement = "expectedField";
+        sourceFileWriter.writeSwitchOpening(statement);
+    }
+    for (unsigned int fieldPosition = 0; fieldPosition < orderedFields.size(); ++fieldPosition)
+    {
+        const MessageFieldModel & messageFieldModel = *orderedFields[fieldPosition].first;
+        const OneofModel * pOneofModel = orderedFields[fieldPosition].second;
 
-    sourceFileWriter.writeSwitchClosing();
-    statement = "pData += fieldBytesParsed;";
+        sourceFileWriter.writeSwitchCaseOpening(to_string(fieldPosition));
+
+        string fieldTagName = className + "Data::m";
+        fieldTagName += messageFieldModel.namePascal() + "Tag";
+        statement = "remainingBytes >= " + fieldTagName + "Size && std::memcmp(pData, " + fieldTagName + ", " + fieldTagName + "Size) == 0";
+        sourceFileWriter.writeIfOpening(statement);
+        statement = "pData += " + fieldTagName + "Size;";
+        sourceFileWriter.writeLineIndented(statement);
+        statement = "remainingBytes -= " + fieldTagName + "Size;";
+        sourceFileWriter.writeLineIndented(statement);
+
+        writeMessageFieldParseCaseToSource(sourceFileWriter, protoModel, messageModel, messageFieldModel, pOneofModel,
+                                           "remainingBytes");
+
+        unsigned int nextField = nextFields[fieldPosition];
+        if (fieldTagRepeats(messageFieldModel))
+        {
+            nextField = fieldPosition;
+        }
+        statement = "expectedField = " + to_string(nextField) + ";";
+        sourceFileWriter.writeLineIndented(statement);
+        statement = "fieldPredicted = true;";
+        sourceFileWriter.writeLineIndented(statement);
+
+        bool nextInSameOneof = pOneofModel != nullptr && fieldPosition + 1 < orderedFields.size() &&
+            orderedFields[fieldPosition + 1].second == pOneofModel;
+        if (fieldTagRepeats(messageFieldModel) || nextInSameOneof)
+        {
+            statement = "break;";
+            sourceFileWriter.writeLineIndented(statement);
+            sourceFileWriter.writeIfClosing();
+            sourceFileWriter.writeSwitchCaseClosingFallthrough();
+            statement = "// Fall through.";
+            sourceFileWriter.writeLineIndented(statement);
+        }
+        else
+        {
+            sourceFileWriter.writeIfClosing();
+            sourceFileWriter.writeSwitchCaseClosing();
+        }
+
+        sourceFileWriter.writeBlankLine();
+    }
+    if (!orderedFields.empty())
+    {
+        sourceFileWriter.writeSwitchDefaultCaseOpening();
+        sourceFileWriter.writeSwitchCaseClosing();
+
+        sourceFileWriter.writeSwitchClosing();
+
+        sourceFileWriter.writeBlankLine();
+    }
+
+    statement = "!fieldPredicted";
+    sourceFileWriter.writeIfOpening(statement);
+
+    statement = "size_t fieldKeyBytesParsed = 0;";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "remainingBytes -= fieldBytesParsed;";
+    statement = "std::uint32_t fieldKey = MuddledManaged::Protocol::PrimitiveEncoding::parseVariableUnsignedInt32(pData, remainingBytes, &fieldKeyBytesParsed);";
+    sourceFileWriter.writeLineIndented(statement);
+    statement = "pData += fieldKeyBytesParsed;";
+    sourceFileWriter.writeLineIndented(statement);
+    statement = "remainingBytes -= fieldKeyBytesParsed;";
     sourceFileWriter.writeLineIndented(statement);
 
-    sourceFileWriter.writeWhileLoopClosing();
+    sourceFileWriter.writeBlankLine();
 
-    statement = "return lengthBytesParsed + length;";
+    statement = "fieldBytesParsed = parseField(fieldKey, pData, remainingBytes, aliased);";
     sourceFileWriter.writeLineIndented(statement);
 
-    sourceFileWriter.writeMethodImplementationClosing();
+    // Data that arrived out of order picks up the prediction again from the field just parsed.
+    if (!orderedFields.empty())
+    {
+        sourceFileWriter.writeBlankLine();
+
+        statement = "fieldKey";
+        sourceFileWriter.writeSwitchOpening(statement);
+        for (unsigned int fieldPosition = 0; fieldPosition < orderedFields.size(); ++fieldPosition)
+        {
+            const MessageFieldModel & messageFieldModel = *orderedFields[fieldPosition].first;
+
+            string fieldKeyName = "(" + className + "Data::m";
+            fieldKeyName += messageFieldModel.namePascal() + "Index << 3) | " + to_string(fieldWireType(messageFieldModel));
+            sourceFileWriter.writeSwitchCaseOpening(fieldKeyName);
+
+            unsigned int nextField = nextFields[fieldPosition];
+            if (fieldTagRepeats(messageFieldModel))
+            {
+                nextField = fieldPosition;
+            }
+            statement = "expectedField = " + to_string(nextField) + ";";
+            sourceFileWriter.writeLineIndented(statement);
+
+            sourceFileWriter.writeSwitchCaseClosing();
+
+            sourceFileWriter.writeBlankLine();
+        }
+        sourceFileWriter.writeSwitchDefaultCaseOpening();
+        sourceFileWriter.writeSwitchCaseClosing();
+
+        sourceFileWriter.writeSwitchClosing();
+    }
+
+    sourceFileWriter.writeIfClosing();
+
+    sourceFileWriter.writeBlankLine();
+}
+
+void Protocol::CodeGeneratorCPP::writeMessageFieldParseToSource (CodeWriter & sourceFileWriter, const MessageFieldModel & messageFieldModel,
+                                                                 const std::string & fieldValueName,
+                                                                 const std::string & availableName) const
+{
+    string statement;
+    switch (messageFieldModel.fieldCategory())
+    {
+        case MessageFieldModel::FieldCategory::stringType:
+        case MessageFieldModel::FieldCategory::bytesType:
+        case MessageFieldModel::FieldCategory::messageType:
+        {
+            statement = "aliased";
+            sourceFileWriter.writeIfOpening(statement);
+            statement = "fieldBytesParsed = ";
+            statement += fieldValueName + ".parseAliased(pData, " + availableName + ");";
+            sourceFileWriter.writeLineIndented(statement);
+            sourceFileWriter.writeIfClosing();
+            sourceFileWriter.writeElseOpening();
+            statement = "fieldBytesParsed = ";
+            statement += fieldValueName + ".parse(pData, " + availableName + ");";
+            sourceFileWriter.writeLineIndented(statement);
+            sourceFileWriter.writeIfClosing();
+            break;
+        }
+
+        default:
+        {
+            statement = "fieldBytesParsed = ";
+            statement += fieldValueName + ".parse(pData, " + availableName + ");";
+            sourceFileWriter.writeLineIndented(statement);
+            break;
+        }
+    }
 }
 
 void Protocol::CodeGeneratorCPP::writeMessageSerializeToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                                                 const MessageModel & messageModel, const std::string & className,
                                                                 const std::string & fullScope) const
 {
-    string methodName = fullScope + "::serialize";
-    string methodReturn = "std::string";
-    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, true);
+    string methodName = fullScope + "::writeTo";
+    string methodReturn = "char *";
+    string methodParameters = "char * pData, const char * pTag, unsigned int tagSize";
+    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters, true);
 
-    string statement = "std::string result;";
+    string statement = "this->index() != 0";
+    sourceFileWriter.writeIfOpening(statement);
+    statement = "pData = writeKeyTo(pData, pTag, tagSize);";
+    sourceFileWriter.writeLineIndented(statement);
+    sourceFileWriter.writeIfClosing();
+    statement = "pData = MuddledManaged::Protocol::PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(cachedContentByteSize()), pData);";
     sourceFileWriter.writeLineIndented(statement);
     sourceFileWriter.writeBlankLine();
 
@@ -1744,21 +3150,26 @@ void Protocol::CodeGeneratorCPP::writeMessageSerializeToSource (CodeWriter & sou
     {
         auto messageFieldModel = *messageFieldBegin;
 
-        string fieldValueName = "mData->m";
-        fieldValueName += messageFieldModel->namePascal();
-        if (messageFieldModel->requiredness() == MessageFieldModel::Requiredness::repeated)
-        {
-            fieldValueName += "Collection";
-        }
-        else
+        string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, *messageFieldModel);
+        string fieldTagName = className + "Data::m" + messageFieldModel->namePascal() + "Tag";
+
+        // Fields that were never set are skipped without calling into them.
+        int bitIndex = hasBitIndex(messageModel, *messageFieldModel);
+        if (bitIndex >= 0)
         {
-            fieldValueName += "Value";
+            statement = "(mData->" + hasBitWordName(bitIndex) + " & " + hasBitMask(bitIndex) + ") != 0";
+            sourceFileWriter.writeIfOpening(statement);
         }
 
-        statement = "result += ";
-        statement += fieldValueName + ".serialize();";
+        statement = "pData = ";
+        statement += fieldValueName + ".writeTo(pData, " + fieldTagName + ", " + fieldTagName + "Size);";
         sourceFileWriter.writeLineIndented(statement);
 
+        if (bitIndex >= 0)
+        {
+            sourceFileWriter.writeIfClosing();
+        }
+
         sourceFileWriter.writeBlankLine();
 
         ++messageFieldBegin;
@@ -1791,19 +3202,11 @@ void Protocol::CodeGeneratorCPP::writeMessageSerializeToSource (CodeWriter & sou
             oneofEnumCase = oneofEnumClassName + "::" + messageFieldModel->name();
             sourceFileWriter.writeSwitchCaseOpening(oneofEnumCase);
 
-            string fieldValueName = "mData->m";
-            fieldValueName += messageFieldModel->namePascal();
-            if (messageFieldModel->requiredness() == MessageFieldModel::Requiredness::repeated)
-            {
-                fieldValueName += "Collection";
-            }
-            else
-            {
-                fieldValueName += "Value";
-            }
+            string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, *messageFieldModel);
+            string fieldTagName = className + "Data::m" + messageFieldModel->namePascal() + "Tag";
 
-            statement = "result += ";
-            statement += fieldValueName + ".serialize();";
+            statement = "pData = ";
+            statement += fieldValueName + ".writeTo(pData, " + fieldTagName + ", " + fieldTagName + "Size);";
             sourceFileWriter.writeLineIndented(statement);
 
             sourceFileWriter.writeSwitchCaseClosing();
@@ -1817,32 +3220,37 @@ void Protocol::CodeGeneratorCPP::writeMessageSerializeToSource (CodeWriter & sou
         ++oneofBegin;
     }
 
-    statement = "result.empty()";
-    sourceFileWriter.writeIfOpening(statement);
-
-    statement = "return result;";
+    statement = "pData = MuddledManaged::Protocol::UnknownFields::writeTo(mData->mUnknownFields, pData);";
     sourceFileWriter.writeLineIndented(statement);
 
-    sourceFileWriter.writeIfClosing();
-
-    statement = "this->index() == 0";
-    sourceFileWriter.writeElseIfOpening(statement);
+    sourceFileWriter.writeBlankLine();
 
-    statement = "result = MuddledManaged::Protocol::PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +";
-    sourceFileWriter.writeLineIndented(statement);
-    statement = "    result;";
+    statement = "return pData;";
     sourceFileWriter.writeLineIndented(statement);
 
-    sourceFileWriter.writeIfClosing();
-    sourceFileWriter.writeElseOpening();
+    sourceFileWriter.writeMethodImplementationClosing();
+}
 
-    statement = "result = MuddledManaged::Protocol::PrimitiveEncoding::serializeVariableUnsignedInt32(key()) +";
-    sourceFileWriter.writeLineIndented(statement);
-    statement = "    MuddledManaged::Protocol::PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +";
+void Protocol::CodeGeneratorCPP::writeMessageByteSizeToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                               const MessageModel & messageModel, const std::string & className,
+                                                               const std::string & fullScope) const
+{
+    string methodName = fullScope + "::byteSize";
+    string methodReturn = "size_t";
+    string methodParameters = "unsigned int tagSize";
+    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, methodParameters, true);
+
+    string statement = "size_t result = contentByteSize();";
     sourceFileWriter.writeLineIndented(statement);
-    statement = "    result;";
+    sourceFileWriter.writeBlankLine();
+
+    statement = "result += MuddledManaged::Protocol::PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));";
     sourceFileWriter.writeLineIndented(statement);
 
+    statement = "this->index() != 0";
+    sourceFileWriter.writeIfOpening(statement);
+    statement = "result += keyByteSize(tagSize);";
+    sourceFileWriter.writeLineIndented(statement);
     sourceFileWriter.writeIfClosing();
 
     sourceFileWriter.writeBlankLine();
@@ -1851,17 +3259,11 @@ void Protocol::CodeGeneratorCPP::writeMessageSerializeToSource (CodeWriter & sou
     sourceFileWriter.writeLineIndented(statement);
 
     sourceFileWriter.writeMethodImplementationClosing();
-}
 
-void Protocol::CodeGeneratorCPP::writeMessageByteSizeToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
-                                                               const MessageModel & messageModel, const std::string & className,
-                                                               const std::string & fullScope) const
-{
-    string methodName = fullScope + "::byteSize";
-    string methodReturn = "size_t";
+    methodName = fullScope + "::contentByteSize";
     sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, true);
 
-    string statement = "size_t result = 0;";
+    statement = "size_t result = 0;";
     sourceFileWriter.writeLineIndented(statement);
     sourceFileWriter.writeBlankLine();
 
@@ -1871,37 +3273,106 @@ void Protocol::CodeGeneratorCPP::writeMessageByteSizeToSource (CodeWriter & sour
     {
         auto messageFieldModel = *messageFieldBegin;
 
-        string fieldValueName = "mData->m";
-        fieldValueName += messageFieldModel->namePascal();
-        if (messageFieldModel->requiredness() == MessageFieldModel::Requiredness::repeated)
-        {
-            fieldValueName += "Collection";
-        }
-        else
+        string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, *messageFieldModel);
+        string fieldTagName = className + "Data::m" + messageFieldModel->namePascal() + "Tag";
+
+        int bitIndex = hasBitIndex(messageModel, *messageFieldModel);
+        if (bitIndex >= 0)
         {
-            fieldValueName += "Value";
+            statement = "(mData->" + hasBitWordName(bitIndex) + " & " + hasBitMask(bitIndex) + ") != 0";
+            sourceFileWriter.writeIfOpening(statement);
         }
 
         statement = "result += ";
-        statement += fieldValueName + ".byteSize();";
+        statement += fieldValueName + ".byteSize(" + fieldTagName + "Size);";
         sourceFileWriter.writeLineIndented(statement);
 
+        if (bitIndex >= 0)
+        {
+            sourceFileWriter.writeIfClosing();
+        }
+
         sourceFileWriter.writeBlankLine();
         
         ++messageFieldBegin;
     }
 
-    statement = "result += MuddledManaged::Protocol::PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));";
+    auto oneofBegin = messageModel.oneofs()->cbegin();
+    auto oneofEnd = messageModel.oneofs()->cend();
+    while (oneofBegin != oneofEnd)
+    {
+        auto oneofModel = *oneofBegin;
+
+        string oneofEnumClassName = oneofModel->namePascal() + "Choices";
+        string oneofEnumInstanceName = "mData->mCurrent";
+        oneofEnumInstanceName += oneofModel->namePascal() + "Choice";
+
+        statement = oneofEnumInstanceName;
+        sourceFileWriter.writeSwitchOpening(statement);
+        string oneofEnumCase = oneofEnumClassName + "::none";
+        sourceFileWriter.writeSwitchCaseOpening(oneofEnumCase);
+        sourceFileWriter.writeSwitchCaseClosing();
+
+        messageFieldBegin = oneofModel->fields()->cbegin();
+        messageFieldEnd = oneofModel->fields()->cend();
+        while (messageFieldBegin != messageFieldEnd)
+        {
+            auto messageFieldModel = *messageFieldBegin;
+
+            sourceFileWriter.writeBlankLine();
+
+            oneofEnumCase = oneofEnumClassName + "::" + messageFieldModel->name();
+            sourceFileWriter.writeSwitchCaseOpening(oneofEnumCase);
+
+            string fieldValueName = "mData->" + fieldReadName(protoModel, messageModel, *messageFieldModel);
+            string fieldTagName = className + "Data::m" + messageFieldModel->namePascal() + "Tag";
+
+            statement = "result += ";
+            statement += fieldValueName + ".byteSize(" + fieldTagName + "Size);";
+            sourceFileWriter.writeLineIndented(statement);
+
+            sourceFileWriter.writeSwitchCaseClosing();
+
+            ++messageFieldBegin;
+        }
+
+        sourceFileWriter.writeSwitchClosing();
+        sourceFileWriter.writeBlankLine();
+
+        ++oneofBegin;
+    }
+
+    statement = "result += mData->mUnknownFields.size();";
+    sourceFileWriter.writeLineIndented(statement);
+
+    sourceFileWriter.writeBlankLine();
+
+    statement = "mData->mContentByteSize.set(result);";
+    sourceFileWriter.writeLineIndented(statement);
+
+    sourceFileWriter.writeBlankLine();
+
+    statement = "return result;";
     sourceFileWriter.writeLineIndented(statement);
+    
+    sourceFileWriter.writeMethodImplementationClosing();
 
-    statement = "result += MuddledManaged::Protocol::PrimitiveEncoding::sizeVariableUnsignedInt32(key());";
+    methodName = fullScope + "::cachedContentByteSize";
+    sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, true);
+
+    statement = "size_t result = 0;";
+    sourceFileWriter.writeLineIndented(statement);
+    statement = "!mData->mContentByteSize.cached(&result)";
+    sourceFileWriter.writeIfOpening(statement);
+    statement = "return contentByteSize();";
     sourceFileWriter.writeLineIndented(statement);
+    sourceFileWriter.writeIfClosing();
 
     sourceFileWriter.writeBlankLine();
 
     statement = "return result;";
     sourceFileWriter.writeLineIndented(statement);
-    
+
     sourceFileWriter.writeMethodImplementationClosing();
 }
 
@@ -1913,31 +3384,48 @@ void Protocol::CodeGeneratorCPP::writeMessageValidToSource (CodeWriter & sourceF
     string methodReturn = "bool";
     sourceFileWriter.writeMethodImplementationOpening(methodName, methodReturn, true);
 
+    // Required fields are checked a whole presence word at a time.
     string statement;
-    auto messageFieldBegin = messageModel.fields()->cbegin();
-    auto messageFieldEnd = messageModel.fields()->cend();
-    while (messageFieldBegin != messageFieldEnd)
+    vector<unsigned int> requiredMasks(hasBitWordCount(messageModel), 0);
+    for (auto & field: *messageModel.fields())
     {
-        auto messageFieldModel = *messageFieldBegin;
-
-        string fieldValueName = "mData->m";
-        fieldValueName += messageFieldModel->namePascal();
-        if (messageFieldModel->requiredness() == MessageFieldModel::Requiredness::repeated)
+        if (field->requiredness() != MessageFieldModel::Requiredness::required)
         {
-            fieldValueName += "Collection";
+            continue;
         }
-        else
+
+        int bitIndex = hasBitIndex(messageModel, *field);
+        requiredMasks[bitIndex / 32] |= 1u << (bitIndex % 32);
+    }
+    for (unsigned int wordIndex = 0; wordIndex < requiredMasks.size(); ++wordIndex)
+    {
+        if (requiredMasks[wordIndex] == 0)
         {
-            fieldValueName += "Value";
+            continue;
         }
 
-        statement = "!" + fieldValueName + ".valid()";
+        string wordMask = hasBitWordMask(requiredMasks[wordIndex]);
+        statement = "(mData->" + hasBitWordName(static_cast<int>(wordIndex * 32)) + " & " + wordMask + ") != " + wordMask;
         sourceFileWriter.writeIfOpening(statement);
         statement = "return false;";
         sourceFileWriter.writeLineIndented(statement);
         sourceFileWriter.writeIfClosing();
+    }
 
-        ++messageFieldBegin;
+    // Only submessages with required fields somewhere below them can ever be invalid.
+    for (auto & field: *messageModel.fields())
+    {
+        const MessageModel * fieldMessage = fieldMessageModel(protoModel, *field);
+        if (fieldMessage == nullptr || !messageRequiresValidation(protoModel, *fieldMessage))
+        {
+            continue;
+        }
+
+        statement = "!mData->" + fieldReadName(protoModel, messageModel, *field) + ".valid()";
+        sourceFileWriter.writeIfOpening(statement);
+        statement = "return false;";
+        sourceFileWriter.writeLineIndented(statement);
+        sourceFileWriter.writeIfClosing();
     }
     statement = "return true;";
     sourceFileWriter.writeLineIndented(statement);
@@ -2187,8 +3675,396 @@ string Protocol::CodeGeneratorCPP::fullTypeNameInternal (const MessageFieldModel
     }
     else
     {
-        fieldType = mBaseClassesNamespace + "::ProtoMessageField<" + fieldType + ">";
+        if (lazyField(messageFieldModel))
+        {
+            fieldType = mBaseClassesNamespace + "::ProtoLazyMessageField<" + fieldType + ">";
+        }
+        else
+        {
+            fieldType = mBaseClassesNamespace + "::ProtoMessageField<" + fieldType + ">";
+        }
     }
 
     return fieldType;
 }
+
+string Protocol::CodeGeneratorCPP::optionValue (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                                const std::string & optionName) const
+{
+    // A message option overrides the same option set for the whole file.
+    for (auto & option: *messageModel.options())
+    {
+        if (option->name() == optionName)
+        {
+            return option->value();
+        }
+    }
+    for (auto & option: *protoModel.options())
+    {
+        if (option->name() == optionName)
+        {
+            return option->value();
+        }
+    }
+    return "";
+}
+
+bool Protocol::CodeGeneratorCPP::optimizeForCodeSize (const ProtoModel & protoModel, const MessageModel & messageModel) const
+{
+    return optionValue(protoModel, messageModel, "optimize_for") == "CODE_SIZE";
+}
+
+bool Protocol::CodeGeneratorCPP::inlineStorage (const ProtoModel & protoModel, const MessageModel & messageModel) const
+{
+    return optionValue(protoModel, messageModel, "storage") == "INLINE";
+}
+
+string Protocol::CodeGeneratorCPP::dataTypeName (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                                 const std::string & className) const
+{
+    if (inlineStorage(protoModel, messageModel))
+    {
+        return mBaseClassesNamespace + "::InlineData<" + className + "Data>";
+    }
+    return "std::shared_ptr<" + className + "Data>";
+}
+
+bool Protocol::CodeGeneratorCPP::epochPresence (const ProtoModel & protoModel, const MessageModel & messageModel) const
+{
+    return optionValue(protoModel, messageModel, "presence") == "EPOCH";
+}
+
+int Protocol::CodeGeneratorCPP::hasBitIndex (const MessageModel & messageModel, const MessageFieldModel & messageFieldModel) const
+{
+    // Collections know whether they hold values and oneof fields already have their current choice.
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        return -1;
+    }
+
+    int bitIndex = 0;
+    for (auto & field: *messageModel.fields())
+    {
+        if (field.get() == &messageFieldModel)
+        {
+            return bitIndex;
+        }
+        if (field->requiredness() != MessageFieldModel::Requiredness::repeated)
+        {
+            ++bitIndex;
+        }
+    }
+
+    return -1;
+}
+
+unsigned int Protocol::CodeGeneratorCPP::hasBitWordCount (const MessageModel & messageModel) const
+{
+    unsigned int bitCount = 0;
+    for (auto & field: *messageModel.fields())
+    {
+        if (field->requiredness() != MessageFieldModel::Requiredness::repeated)
+        {
+            ++bitCount;
+        }
+    }
+
+    return (bitCount + 31) / 32;
+}
+
+string Protocol::CodeGeneratorCPP::hasBitWordName (int bitIndex) const
+{
+    return "mHasBits[" + to_string(bitIndex / 32) + "]";
+}
+
+string Protocol::CodeGeneratorCPP::hasBitMask (int bitIndex) const
+{
+    return hasBitWordMask(1u << (bitIndex % 32));
+}
+
+string Protocol::CodeGeneratorCPP::hasBitWordMask (unsigned int wordMask) const
+{
+    ostringstream mask;
+    mask << "0x" << hex << setw(8) << setfill('0') << wordMask << "u";
+
+    return mask.str();
+}
+
+string Protocol::CodeGeneratorCPP::fieldAbsentCondition (const MessageModel & messageModel, const MessageFieldModel & messageFieldModel,
+                                                         const OneofModel * oneofModel) const
+{
+    if (oneofModel != nullptr)
+    {
+        string condition = "mData->mCurrent" + oneofModel->namePascal() + "Choice != ";
+        condition += oneofModel->namePascal() + "Choices::" + messageFieldModel.name();
+
+        return condition;
+    }
+
+    int bitIndex = hasBitIndex(messageModel, messageFieldModel);
+
+    return "(mData->" + hasBitWordName(bitIndex) + " & " + hasBitMask(bitIndex) + ") == 0";
+}
+
+const Protocol::MessageModel * Protocol::CodeGeneratorCPP::fieldMessageModel (const ProtoModel & protoModel,
+                                                                             const MessageFieldModel & messageFieldModel) const
+{
+    if (messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::messageType)
+    {
+        return nullptr;
+    }
+
+    string fullName = messageFieldModel.fieldTypePackage();
+    if (!fullName.empty())
+    {
+        fullName += ".";
+    }
+    fullName += messageFieldModel.fieldType();
+
+    auto typeIter = protoModel.privateMessageTypes()->find(fullName);
+    if (typeIter != protoModel.privateMessageTypes()->end())
+    {
+        return typeIter->second.get();
+    }
+    typeIter = protoModel.publicMessageTypes()->find(fullName);
+    if (typeIter != protoModel.publicMessageTypes()->end())
+    {
+        return typeIter->second.get();
+    }
+    return nullptr;
+}
+
+bool Protocol::CodeGeneratorCPP::messageRequiresValidation (const ProtoModel & protoModel, const MessageModel & messageModel) const
+{
+    vector<const MessageModel *> visitedMessages;
+
+    return messageRequiresValidation(protoModel, messageModel, visitedMessages);
+}
+
+bool Protocol::CodeGeneratorCPP::messageRequiresValidation (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                                            vector<const MessageModel *> & visitedMessages) const
+{
+    // A message that refers back to itself is already being answered further up, so it adds nothing here.
+    if (find(visitedMessages.begin(), visitedMessages.end(), &messageModel) != visitedMessages.end())
+    {
+        return false;
+    }
+    visitedMessages.push_back(&messageModel);
+
+    for (auto & field: *messageModel.fields())
+    {
+        if (field->requiredness() == MessageFieldModel::Requiredness::required)
+        {
+            return true;
+        }
+
+        const MessageModel * fieldMessage = fieldMessageModel(protoModel, *field);
+        if (fieldMessage != nullptr && messageRequiresValidation(protoModel, *fieldMessage, visitedMessages))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+string Protocol::CodeGeneratorCPP::fieldStorageName (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                                     const MessageFieldModel & messageFieldModel) const
+{
+    string suffix = "Value";
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        suffix = "Collection";
+    }
+
+    // Epoch presence goes through an accessor that resets a field left over from before the last clear.
+    if (epochPresence(protoModel, messageModel))
+    {
+        return "current" + messageFieldModel.namePascal() + suffix + "()";
+    }
+    return "m" + messageFieldModel.namePascal() + suffix;
+}
+
+string Protocol::CodeGeneratorCPP::fieldReadName (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                                  const MessageFieldModel & messageFieldModel) const
+{
+    string suffix = "Value";
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        suffix = "Collection";
+    }
+
+    // Reading a field must not reset it, so const methods stay safe to call from several threads at once.
+    if (epochPresence(protoModel, messageModel))
+    {
+        return "read" + messageFieldModel.namePascal() + suffix + "()";
+    }
+    return "m" + messageFieldModel.namePascal() + suffix;
+}
+
+bool Protocol::CodeGeneratorCPP::lazyField (const MessageFieldModel & messageFieldModel) const
+{
+    // Only singular message fields can be decoded lazily.
+    if (messageFieldModel.fieldCategory() != MessageFieldModel::FieldCategory::messageType ||
+        messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        return false;
+    }
+    for (auto & option: *messageFieldModel.options())
+    {
+        if (option->name() == "lazy")
+        {
+            return option->value() == "true";
+        }
+    }
+    return false;
+}
+
+string Protocol::CodeGeneratorCPP::fieldKindName (const MessageFieldModel & messageFieldModel) const
+{
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        return "otherKind";
+    }
+
+    string fieldType = messageFieldModel.fieldType();
+    if (fieldType == "bool")
+    {
+        return "boolKind";
+    }
+    if (fieldType == "string" || fieldType == "bytes")
+    {
+        return "stringKind";
+    }
+    if (fieldType == "double")
+    {
+        return "doubleKind";
+    }
+    if (fieldType == "float")
+    {
+        return "floatKind";
+    }
+    if (fieldType == "int32")
+    {
+        return "int32Kind";
+    }
+    if (fieldType == "int64")
+    {
+        return "int64Kind";
+    }
+    if (fieldType == "uint32")
+    {
+        return "unsignedInt32Kind";
+    }
+    if (fieldType == "uint64")
+    {
+        return "unsignedInt64Kind";
+    }
+    if (fieldType == "sint32")
+    {
+        return "signedInt32Kind";
+    }
+    if (fieldType == "sint64")
+    {
+        return "signedInt64Kind";
+    }
+    if (fieldType == "fixed32" || fieldType == "sfixed32")
+    {
+        return "fixedInt32Kind";
+    }
+    if (fieldType == "fixed64" || fieldType == "sfixed64")
+    {
+        return "fixedInt64Kind";
+    }
+    return "otherKind";
+}
+
+unsigned int Protocol::CodeGeneratorCPP::fieldWireType (const MessageFieldModel & messageFieldModel) const
+{
+    // Repeated fields are always written packed.
+    if (messageFieldModel.requiredness() == MessageFieldModel::Requiredness::repeated)
+    {
+        return 2;
+    }
+
+    string fieldType = messageFieldModel.fieldType();
+    if (fieldType == "double" || fieldType == "fixed64" || fieldType == "sfixed64")
+    {
+        return 1;
+    }
+    if (fieldType == "float" || fieldType == "fixed32" || fieldType == "sfixed32")
+    {
+        return 5;
+    }
+
+    switch (messageFieldModel.fieldCategory())
+    {
+        case MessageFieldModel::FieldCategory::stringType:
+        case MessageFieldModel::FieldCategory::bytesType:
+        case MessageFieldModel::FieldCategory::messageType:
+            return 2;
+
+        default:
+            return 0;
+    }
+}
+
+vector<unsigned char> Protocol::CodeGeneratorCPP::fieldTagBytes (const MessageFieldModel & messageFieldModel) const
+{
+    vector<unsigned char> tagBytes;
+    unsigned int fieldKey = (messageFieldModel.index() << 3) | fieldWireType(messageFieldModel);
+    while (fieldKey >= 0x80)
+    {
+        tagBytes.push_back(static_cast<unsigned char>(fieldKey | 0x80));
+        fieldKey >>= 7;
+    }
+    tagBytes.push_back(static_cast<unsigned char>(fieldKey));
+
+    return tagBytes;
+}
+
+bool Protocol::CodeGeneratorCPP::fieldTagRepeats (const MessageFieldModel & messageFieldModel) const
+{
+    // Repeated numeric fields are packed behind a single tag, but every string, bytes, or message value has its own.
+    if (messageFieldModel.requiredness() != MessageFieldModel::Requiredness::repeated)
+    {
+        return false;
+    }
+
+    switch (messageFieldModel.fieldCategory())
+    {
+        case MessageFieldModel::FieldCategory::stringType:
+        case MessageFieldModel::FieldCategory::bytesType:
+        case MessageFieldModel::FieldCategory::messageType:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+unsigned int Protocol::CodeGeneratorCPP::fieldTableDenseCount (const MessageModel & messageModel) const
+{
+    // Field indexes are looked up directly when the lookup array stays within a small multiple of the
+    // number of fields. Sparse indexes such as 1 and 200 fall back to searching the sorted entries.
+    unsigned int maxIndex = 0;
+    unsigned int fieldCount = 0;
+    for (auto & messageFieldModel: *messageModel.fields())
+    {
+        maxIndex = std::max(maxIndex, messageFieldModel->index());
+        ++fieldCount;
+    }
+    for (auto & oneofModel: *messageModel.oneofs())
+    {
+        for (auto & messageFieldModel: *oneofModel->fields())
+        {
+            maxIndex = std::max(maxIndex, messageFieldModel->index());
+            ++fieldCount;
+        }
+    }
+    if (fieldCount == 0 || maxIndex >= 2 * fieldCount + 16)
+    {
+        return 0;
+    }
+    return maxIndex + 1;
+}
@@ -43,6 +43,57 @@ namespace MuddledManaged
 
             std::string fullTypeNameInternal (const MessageFieldModel & messageFieldModel) const;
 
+            std::string optionValue (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                     const std::string & optionName) const;
+
+            bool optimizeForCodeSize (const ProtoModel & protoModel, const MessageModel & messageModel) const;
+
+            bool inlineStorage (const ProtoModel & protoModel, const MessageModel & messageModel) const;
+
+            std::string dataTypeName (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                      const std::string & className) const;
+
+            bool epochPresence (const ProtoModel & protoModel, const MessageModel & messageModel) const;
+
+            std::string fieldStorageName (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                          const MessageFieldModel & messageFieldModel) const;
+
+            std::string fieldReadName (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                       const MessageFieldModel & messageFieldModel) const;
+
+            int hasBitIndex (const MessageModel & messageModel, const MessageFieldModel & messageFieldModel) const;
+
+            unsigned int hasBitWordCount (const MessageModel & messageModel) const;
+
+            std::string hasBitWordName (int bitIndex) const;
+
+            std::string hasBitMask (int bitIndex) const;
+
+            std::string hasBitWordMask (unsigned int wordMask) const;
+
+            std::string fieldAbsentCondition (const MessageModel & messageModel, const MessageFieldModel & messageFieldModel,
+                                              const OneofModel * oneofModel) const;
+
+            const MessageModel * fieldMessageModel (const ProtoModel & protoModel,
+                                                    const MessageFieldModel & messageFieldModel) const;
+
+            bool messageRequiresValidation (const ProtoModel & protoModel, const MessageModel & messageModel) const;
+
+            bool messageRequiresValidation (const ProtoModel & protoModel, const MessageModel & messageModel,
+                                            std::vector<const MessageModel *> & visitedMessages) const;
+
+            bool lazyField (const MessageFieldModel & messageFieldModel) const;
+
+            std::string fieldKindName (const MessageFieldModel & messageFieldModel) const;
+
+            unsigned int fieldWireType (const MessageFieldModel & messageFieldModel) const;
+
+            std::vector<unsigned char> fieldTagBytes (const MessageFieldModel & messageFieldModel) const;
+
+            bool fieldTagRepeats (const MessageFieldModel & messageFieldModel) const;
+
+            unsigned int fieldTableDenseCount (const MessageModel & messageModel) const;
+
             void writeStandardIncludeFileNamesToHeader (CodeWriter & headerFileWriter, bool includeBase) const;
 
             void writeIncludedProtoFileNamesToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel) const;
@@ -78,60 +129,115 @@ namespace MuddledManaged
             void writeMessageSwapToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
                                            const MessageModel & messageModel, const std::string & className) const;
 
+            void writeMessageDeepCopyToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                               const MessageModel & messageModel, const std::string & className) const;
+
             void writeMessageClearToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
                                             const MessageModel & messageModel, const std::string & className) const;
 
+            void writeMessageDataRestore (CodeWriter & writer, const ProtoModel & protoModel,
+                                          const MessageModel & messageModel, const std::string & className) const;
+
+            void writeMessageUnknownFieldsToHeader (CodeWriter & headerFileWriter) const;
+
             void writeMessageFieldToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                            const MessageModel & messageModel,
                                             const MessageFieldModel & messageFieldModel) const;
 
             void writeMessageOneofFieldToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                 const MessageModel & messageModel,
                                                  const MessageFieldModel & messageFieldModel, const OneofModel & oneofModel) const;
 
             void writeMessageFieldSizeRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                        const MessageModel & messageModel,
                                                         const MessageFieldModel & messageFieldModel) const;
 
             void writeMessageFieldGetRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                       const MessageModel & messageModel,
                                                        const MessageFieldModel & messageFieldModel) const;
 
+            void writeMessageFieldViewRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                        const MessageModel & messageModel,
+                                                        const MessageFieldModel & messageFieldModel) const;
+
             void writeMessageFieldSetRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                       const MessageModel & messageModel,
                                                        const MessageFieldModel & messageFieldModel) const;
 
             void writeMessageFieldAddRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                       const MessageModel & messageModel,
                                                        const MessageFieldModel & messageFieldModel) const;
 
+            void writeMessageFieldBulkRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                        const MessageModel & messageModel,
+                                                        const MessageFieldModel & messageFieldModel) const;
+
             void writeMessageFieldAddNewRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                          const MessageModel & messageModel,
                                                           const MessageFieldModel & messageFieldModel) const;
 
+            void writeMessageFieldMutableRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                           const MessageModel & messageModel,
+                                                           const MessageFieldModel & messageFieldModel) const;
+
             void writeMessageFieldClearRepeatedToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                         const MessageModel & messageModel,
                                                          const MessageFieldModel & messageFieldModel) const;
 
             void writeMessageFieldHasToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                               const MessageModel & messageModel,
                                                const MessageFieldModel & messageFieldModel,
                                                const OneofModel * oneofModel = nullptr) const;
 
             void writeMessageFieldGetToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                               const MessageModel & messageModel,
                                                const MessageFieldModel & messageFieldModel,
                                                const OneofModel * oneofModel = nullptr) const;
 
+            void writeMessageFieldViewToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                const MessageModel & messageModel,
+                                                const MessageFieldModel & messageFieldModel,
+                                                const OneofModel * oneofModel = nullptr) const;
+
             void writeMessageFieldSetToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                               const MessageModel & messageModel,
                                                const MessageFieldModel & messageFieldModel,
                                                const OneofModel * oneofModel = nullptr) const;
 
             void writeMessageFieldCreateNewToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                     const MessageModel & messageModel,
                                                      const MessageFieldModel & messageFieldModel,
                                                      const OneofModel * oneofModel = nullptr) const;
 
+            void writeMessageFieldMutableToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                   const MessageModel & messageModel,
+                                                   const MessageFieldModel & messageFieldModel,
+                                                   const OneofModel * oneofModel = nullptr) const;
+
+            void writeHasBitSetToHeader (CodeWriter & headerFileWriter, const MessageModel & messageModel,
+                                         const MessageFieldModel & messageFieldModel) const;
+
+            void writeOneofChoiceToHeader (CodeWriter & sourceFileWriter, const MessageFieldModel & messageFieldModel,
+                                           const OneofModel * oneofModel) const;
+
             void writeMessageFieldClearToHeader (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                 const MessageModel & messageModel,
                                                  const MessageFieldModel & messageFieldModel,
                                                  const OneofModel * oneofModel = nullptr) const;
 
+            void writeMessageDataFieldCurrentToHeader (CodeWriter & headerFileWriter,
+                                                       const MessageFieldModel & messageFieldModel) const;
+
             void writeMessageFieldBackingFieldsToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
                                                          const MessageFieldModel & messageFieldModel) const;
 
             void writeMessageFieldIndexToHeader (CodeWriter & headerFileWriter,
                                                  const MessageFieldModel & messageFieldModel) const;
 
+            void writeMessageByteSizeInvalidationToHeader (CodeWriter & headerFileWriter) const;
+
             void writeOneofToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
+                                            const MessageModel & messageModel,
                                             const OneofModel & oneofModel) const;
 
             void writeOneofBackingFieldsToHeader (CodeWriter & headerFileWriter, const ProtoModel & protoModel,
@@ -151,20 +257,49 @@ namespace MuddledManaged
             void writeMessageToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                        const MessageModel & messageModel, const std::string & className) const;
 
+            void writeMessageFieldDescriptorsToSource (CodeWriter & sourceFileWriter, const MessageModel & messageModel,
+                                                       const std::string & className, const std::string & fullScope) const;
+
             void writeMessageDataConstructorToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                                   const MessageModel & messageModel, const std::string & className,
                                                   const std::string & fullScope) const;
 
+            void writeMessageDataClearToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                const MessageModel & messageModel, const std::string & className,
+                                                const std::string & fullScope) const;
+
+            void writeMessageDataFieldClearToSource (CodeWriter & sourceFileWriter,
+                                                     const MessageFieldModel & messageFieldModel,
+                                                     bool resetEpoch) const;
+
             void writeMessageDataFieldInitializationToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                                               const MessageFieldModel & messageFieldModel, const std::string & className,
                                                               const std::string & fullScope) const;
 
-            std::string messageFieldInitialization (const MessageFieldModel & messageFieldModel) const;
+            std::string messageFieldDescriptorType (const MessageFieldModel & messageFieldModel) const;
+
+            std::string messageFieldDefaultValue (const MessageFieldModel & messageFieldModel) const;
+
+            void writeMessageFieldTableToHeader (CodeWriter & headerFileWriter, const MessageModel & messageModel) const;
+
+            void writeMessageFieldTableToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                 const MessageModel & messageModel, const std::string & className,
+                                                 const std::string & fullScope) const;
 
             void writeMessageParseToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                             const MessageModel & messageModel, const std::string & className,
                                             const std::string & fullScope) const;
 
+            void writeMessageFieldParseToSource (CodeWriter & sourceFileWriter, const MessageFieldModel & messageFieldModel,
+                                                 const std::string & fieldValueName, const std::string & availableName) const;
+
+            void writeMessageFieldParseCaseToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                     const MessageModel & messageModel, const MessageFieldModel & messageFieldModel,
+                                                     const OneofModel * pOneofModel, const std::string & availableName) const;
+
+            void writeMessageParsePredictionToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
+                                                      const MessageModel & messageModel, const std::string & className) const;
+
             void writeMessageSerializeToSource (CodeWriter & sourceFileWriter, const ProtoModel & protoModel,
                                                 const MessageModel & messageModel, const std::string & className,
                                                 const std::string & fullScope) const;
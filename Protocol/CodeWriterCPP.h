@@ -123,6 +123,11 @@ namespace MuddledManaged
                 mStream << "using namespace " << namespaceName << ";" << std::endl;
             }
 
+            void writeUsingDeclaration (const std::string & declarationName)
+            {
+                mStream << mIndenter.prefix() << "using " << declarationName << ";" << std::endl;
+            }
+
             void writeTypedef (const std::string & typeString, const std::string & definitionString)
             {
                 mStream << mIndenter.prefix() << "typedef " << typeString << " " << definitionString << ";" << std::endl;
@@ -177,9 +182,13 @@ namespace MuddledManaged
                 mStream << mIndenter.prefix() << "};" << std::endl << std::endl;
             }
 
-            void writeClassOpening (const std::string & className, const std::string & classInheritance = "")
+            void writeClassOpening (const std::string & className, const std::string & classInheritance = "", bool isFinal = false)
             {
                 mStream << mIndenter.prefix() << "class " << className;
+                if (isFinal)
+                {
+                    mStream << " final";
+                }
                 if (!classInheritance.empty())
                 {
                     mStream << " : " << classInheritance;
@@ -251,6 +260,25 @@ namespace MuddledManaged
                 mStream << fieldType << " " << fieldName << " = " << fieldValue << std::endl;
             }
 
+            void writeStaticFieldDefinitionOpening (const std::string & fieldName,
+                                                    const std::string & fieldType)
+            {
+                mStream << mIndenter.prefix() << fieldType << " " << fieldName << " =" << std::endl;
+                writeCurlyBraceOpening();
+            }
+
+            void writeStaticFieldDefinitionClosing ()
+            {
+                --mIndenter;
+                mStream << mIndenter.prefix() << "};" << std::endl << std::endl;
+            }
+
+            void writeStaticFieldDefinition (const std::string & fieldName,
+                                             const std::string & fieldType)
+            {
+                mStream << mIndenter.prefix() << fieldType << " " << fieldName << ";" << std::endl;
+            }
+
             std::string getMethodParameterString (const std::vector<std::string> & methodParameters)
             {
                 std::string parameterString;
@@ -346,7 +374,8 @@ namespace MuddledManaged
                                                 const std::string & methodReturn,
                                                 const std::string & methodParameters,
                                                 bool isConst = false,
-                                                bool isVirtual = false)
+                                                bool isVirtual = false,
+                                                bool isNoexcept = false)
             {
                 mStream << mIndenter.prefix();
 
@@ -362,6 +391,11 @@ namespace MuddledManaged
                     mStream << " const";
                 }
 
+                if (isNoexcept)
+                {
+                    mStream << " noexcept";
+                }
+
                 mStream << std::endl;
 
                 writeCurlyBraceOpening();
@@ -406,12 +440,18 @@ namespace MuddledManaged
 
             void writeConstructorImplementationOpening (const std::string & className,
                                                         const std::string & constructorParameters,
-                                                        const std::string & initializationParameters)
+                                                        const std::string & initializationParameters,
+                                                        bool isNoexcept = false)
             {
                 mStream << mIndenter.prefix();
 
                 writeMethodSignature(className, "", constructorParameters);
 
+                if (isNoexcept)
+                {
+                    mStream << " noexcept";
+                }
+
                 if (!initializationParameters.empty())
                 {
                     mStream << std::endl;
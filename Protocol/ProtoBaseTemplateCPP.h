@@ -35,593 +35,2184 @@ R"MuddledManaged(namespace MuddledManaged
 
             std::string mMessage;
         };
-        
-        class PrimitiveEncoding
+
+        // Hands out memory from large blocks that are all released together when the arena is destroyed.
+        // Objects placed in an arena must not outlive it. An arena is not safe to use from multiple threads.
+        class Arena
         {
         public:
-            static size_t sizeVariableInt32 (std::int32_t value)
-            {
-                return sizeVariableUnsignedInt32(static_cast<std::uint32_t>(value));
-            }
-            
-            static size_t sizeVariableUnsignedInt32 (std::uint32_t value)
-            {
-                std::uint32_t shiftBit = 1;
+            explicit Arena (size_t blockSize = 4096)
+            : mBlockSize(blockSize), mCurrent(nullptr), mRemaining(0)
+            {}
 
-                if (value < (shiftBit << 7))
-                {
-                    return 1;
-                }
-                else if (value < (shiftBit << 14))
-                {
-                    return 2;
-                }
-                else if (value < (shiftBit << 21))
-                {
-                    return 3;
-                }
-                else if (value < (shiftBit << 28))
+            void * allocate (size_t size, size_t alignment)
+            {
+                size_t padding = alignmentPadding(mCurrent, alignment);
+                if (mCurrent == nullptr || padding + size > mRemaining)
                 {
-                    return 4;
-                }
-                return 5;
-            }
+                    size_t blockSize = size + alignment > mBlockSize ? size + alignment : mBlockSize;
 
-            static size_t sizeVariableSignedInt32 (std::int32_t value)
-            {
-                std::uint32_t unsignedValue = static_cast<std::uint32_t>(value);
+                    mBlocks.push_back(std::unique_ptr<char[]>(new char[blockSize]));
+                    mCurrent = mBlocks.back().get();
+                    mRemaining = blockSize;
 
-                unsignedValue = (unsignedValue << 1) ^ (value >> 31);
+                    padding = alignmentPadding(mCurrent, alignment);
+                }
 
-                return sizeVariableUnsignedInt32(unsignedValue);
+                char * result = mCurrent + padding;
+                mCurrent = result + size;
+                mRemaining -= padding + size;
+
+                return result;
             }
 
-            static size_t sizeVariableInt64 (std::int64_t value)
+            size_t blockCount () const
             {
-                return sizeVariableUnsignedInt64(static_cast<std::uint64_t>(value));
+                return mBlocks.size();
             }
 
-            static size_t sizeVariableUnsignedInt64 (std::uint64_t value)
+        private:
+            Arena (const Arena & src) = delete;
+            Arena & operator = (const Arena & rhs) = delete;
+
+            static size_t alignmentPadding (const char * pData, size_t alignment)
             {
-                std::uint64_t shiftBit = 1;
+                size_t misalignment = reinterpret_cast<std::uintptr_t>(pData) % alignment;
 
-                if (value < (shiftBit << 7))
-                {
-                    return 1;
-                }
-                else if (value < (shiftBit << 14))
-                {
-                    return 2;
-                }
-                else if (value < (shiftBit << 21))
-                {
-                    return 3;
-                }
-                else if (value < (shiftBit << 28))
-                {
-                    return 4;
-                }
-                else if (value < (shiftBit << 35))
-                {
-                    return 5;
-                }
-                else if (value < (shiftBit << 42))
-                {
-                    return 6;
-                }
-                else if (value < (shiftBit << 49))
-                {
-                    return 7;
-                }
-                else if (value < (shiftBit << 56))
-                {
-                    return 8;
-                }
-                else if (value < (shiftBit << 63))
-                {
-                    return 9;
-                }
-                return 10;
+                return misalignment == 0 ? 0 : alignment - misalignment;
             }
 
-            static size_t sizeVariableSignedInt64 (std::int64_t value)
-            {
-                std::uint64_t unsignedValue = static_cast<std::uint64_t>(value);
+            std::vector<std::unique_ptr<char[]>> mBlocks;
+            size_t mBlockSize;
+            char * mCurrent;
+            size_t mRemaining;
+        };
 
-                unsignedValue = (unsignedValue << 1) ^ (value >> 63);
+        template <typename ValueType>
+        class ArenaAllocator
+        {
+        public:
+            typedef ValueType value_type;
 
-                return sizeVariableUnsignedInt64(unsignedValue);
-            }
+            explicit ArenaAllocator (Arena * pArena)
+            : mArena(pArena)
+            {}
 
-            static std::int32_t parseVariableInt32 (const char * pData, size_t * pBytesParsed)
+            template <typename OtherType>
+            ArenaAllocator (const ArenaAllocator<OtherType> & src)
+            : mArena(src.arena())
+            {}
+
+            ValueType * allocate (size_t count)
             {
-                return parseVariable<std::int32_t>(pData, pBytesParsed);
+                if (mArena == nullptr)
+                {
+                    return static_cast<ValueType *>(::operator new(count * sizeof(ValueType)));
+                }
+                return static_cast<ValueType *>(mArena->allocate(count * sizeof(ValueType), alignof(ValueType)));
             }
 
-            static std::int32_t parseFixedInt32 (const char * pData)
+            void deallocate (ValueType * pValue, size_t)
             {
-                return parseFixed<std::int32_t>(pData);
+                if (mArena == nullptr)
+                {
+                    ::operator delete(pValue);
+                }
             }
 
-            static std::int64_t parseVariableInt64 (const char * pData, size_t * pBytesParsed)
+            Arena * arena () const
             {
-                return parseVariable<std::int64_t>(pData, pBytesParsed);
+                return mArena;
             }
 
-            static std::int64_t parseFixedInt64 (const char * pData)
+        private:
+            Arena * mArena;
+        };
+
+        template <typename ValueType, typename OtherType>
+        bool operator == (const ArenaAllocator<ValueType> & lhs, const ArenaAllocator<OtherType> & rhs)
+        {
+            return lhs.arena() == rhs.arena();
+        }
+
+        template <typename ValueType, typename OtherType>
+        bool operator != (const ArenaAllocator<ValueType> & lhs, const ArenaAllocator<OtherType> & rhs)
+        {
+            return lhs.arena() != rhs.arena();
+        }
+
+        template <typename ValueType, typename... Arguments>
+        std::shared_ptr<ValueType> makeShared (Arena * pArena, Arguments &&... arguments)
+        {
+            if (pArena == nullptr)
             {
-                return parseFixed<std::int64_t>(pData);
+                return std::shared_ptr<ValueType>(new ValueType(std::forward<Arguments>(arguments)...));
             }
+            return std::allocate_shared<ValueType>(ArenaAllocator<ValueType>(pArena), std::forward<Arguments>(arguments)...);
+        }
 
-            static std::int32_t parseVariableSignedInt32 (const char * pData, size_t * pBytesParsed)
+        // Holds the data of a message that uses inline storage. The data lives inside the message instead of behind
+        // a shared pointer, so copying the message copies the data and creating one needs no extra allocation. Access
+        // works like the shared pointer it replaces, including from const methods.
+        template <typename DataType>
+        class InlineData
+        {
+        public:
+            explicit InlineData (Arena * pArena)
+            : mData(pArena)
+            {}
+
+            DataType * operator -> () const
             {
-                return parseVariable<std::int32_t>(pData, pBytesParsed, true);
+                return &mData;
             }
 
-            static std::int32_t parseFixedSignedInt32 (const char * pData)
+            DataType * get () const
             {
-                return parseFixed<std::int32_t>(pData);
+                return &mData;
             }
 
-            static std::int64_t parseVariableSignedInt64 (const char * pData, size_t * pBytesParsed)
+        private:
+            mutable DataType mData;
+        };
+
+        // Holds a byte size that const methods remember for the next serialize. Several threads may size the same const
+        // message at once, so the size lives in one relaxed atomic that holds the size plus one, or zero when nothing
+        // is cached. Readers then never see a size without the flag that goes with it.
+        class CachedByteSize
+        {
+        public:
+            CachedByteSize ()
+            : mSizePlusOne(0)
+            {}
+
+            CachedByteSize (const CachedByteSize & src)
+            : mSizePlusOne(src.mSizePlusOne.load(std::memory_order_relaxed))
+            {}
+
+            CachedByteSize & operator = (const CachedByteSize & rhs)
             {
-                return parseVariable<std::int64_t>(pData, pBytesParsed, true);
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                mSizePlusOne.store(rhs.mSizePlusOne.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+                return *this;
             }
 
-            static std::int64_t parseFixedSignedInt64 (const char * pData)
+            bool cached (size_t * pSize) const
             {
-                return parseFixed<std::int64_t>(pData);
+                size_t sizePlusOne = mSizePlusOne.load(std::memory_order_relaxed);
+                if (sizePlusOne == 0)
+                {
+                    return false;
+                }
+
+                *pSize = sizePlusOne - 1;
+
+                return true;
             }
 
-            static std::uint32_t parseVariableUnsignedInt32 (const char * pData, size_t * pBytesParsed)
+            void set (size_t size) const
             {
-                return parseVariable<std::uint32_t>(pData, pBytesParsed);
+                mSizePlusOne.store(size + 1, std::memory_order_relaxed);
             }
 
-            static std::uint64_t parseVariableUnsignedInt64 (const char * pData, size_t * pBytesParsed)
+            void invalidate () const
             {
-                return parseVariable<std::uint64_t>(pData, pBytesParsed);
+                mSizePlusOne.store(0, std::memory_order_relaxed);
             }
 
-            static float parseFloat (const char * pData)
+        private:
+            mutable std::atomic<size_t> mSizePlusOne;
+        };
+
+        // Shares one message between copies until one of them needs to change it. Only then is the message copied.
+        // This gives cheap copies of messages that use inline storage when most copies are only read.
+        template <typename MessageType>
+        class CopyOnWrite
+        {
+        public:
+            CopyOnWrite ()
+            : mValue(new MessageType())
+            {}
+
+            explicit CopyOnWrite (const MessageType & message)
+            : mValue(new MessageType(message))
+            {}
+
+            const MessageType & operator * () const
             {
-                return parseFixed<float>(pData);
+                return *mValue;
             }
 
-            static double parseDouble (const char * pData)
+            const MessageType * operator -> () const
             {
-                return parseFixed<double>(pData);
+                return mValue.get();
             }
 
-            static std::string parseString (const char * pData, size_t * pBytesParsed)
+            const MessageType & value () const
             {
-                return parseBytes(pData, pBytesParsed);
+                return *mValue;
             }
 
-            static std::string parseBytes (const char * pData, size_t * pBytesParsed)
+            MessageType & mutableValue ()
             {
-                if (pData == nullptr)
+                if (mValue.use_count() > 1)
                 {
-                    throw std::invalid_argument("pData cannot be null.");
+                    mValue.reset(new MessageType(mValue->deepCopy()));
                 }
+                return *mValue;
+            }
 
-                size_t bytesParsed = 0;
-                std::uint32_t length = parseVariableUnsignedInt32(pData, &bytesParsed);
-                pData += bytesParsed;
+            bool shared () const
+            {
+                return mValue.use_count() > 1;
+            }
 
-                std::string result;
-                for (unsigned int i = 0; i < length; ++i)
-                {
-                    result += *pData;
-                    ++pData;
-                }
+        private:
+            std::shared_ptr<MessageType> mValue;
+        };
 
-                if (pBytesParsed != nullptr)
-                {
-                    *pBytesParsed = bytesParsed + length;
-                }
+        class ByteView
+        {
+        public:
+            ByteView ()
+            : mData(nullptr), mSize(0)
+            {}
 
-                return result;
+            ByteView (const char * pData, size_t size)
+            : mData(pData), mSize(size)
+            {}
+
+            ByteView (const std::string & value)
+            : mData(value.data()), mSize(value.size())
+            {}
+
+            const char * data () const
+            {
+                return mData;
             }
 
-            static std::string serializeVariableInt32 (std::int32_t value)
+            size_t size () const
             {
-                return serializeVariable<std::int64_t>(value);
+                return mSize;
             }
 
-            static std::string serializeFixedInt32 (std::int32_t value)
+            bool empty () const
             {
-                return serializeFixed<std::int32_t>(value);
+                return mSize == 0;
             }
 
-            static std::string serializeVariableInt64 (std::int64_t value)
+            std::string toString () const
             {
-                return serializeVariable<std::int64_t>(value);
+                if (mSize == 0)
+                {
+                    return std::string();
+                }
+                return std::string(mData, mSize);
             }
 
-            static std::string serializeFixedInt64 (std::int64_t value)
+        private:
+            const char * mData;
+            size_t mSize;
+        };
+        
+        template <typename ValueType>
+        class ArrayView
+        {
+        public:
+            ArrayView ()
+            : mData(nullptr), mSize(0)
+            {}
+
+            ArrayView (const ValueType * pData, size_t size)
+            : mData(pData), mSize(size)
+            {}
+
+            const ValueType * data () const
             {
-                return serializeFixed<std::int64_t>(value);
+                return mData;
             }
 
-            static std::string serializeVariableSignedInt32 (std::int32_t value)
+            size_t size () const
             {
-                return serializeVariable<std::int32_t>(value, true);
+                return mSize;
             }
 
-            static std::string serializeFixedSignedInt32 (std::int32_t value)
+            bool empty () const
             {
-                return serializeFixed<std::int32_t>(value);
+                return mSize == 0;
             }
 
-            static std::string serializeVariableSignedInt64 (std::int64_t value)
+            const ValueType * begin () const
             {
-                return serializeVariable<std::int64_t>(value, true);
+                return mData;
             }
 
-            static std::string serializeFixedSignedInt64 (std::int64_t value)
+            const ValueType * end () const
             {
-                return serializeFixed<std::int64_t>(value);
+                return mData + mSize;
             }
 
-            static std::string serializeVariableUnsignedInt32 (std::uint32_t value)
+            const ValueType & operator [] (size_t index) const
             {
-                return serializeVariable<std::uint32_t>(value);
+                return mData[index];
             }
 
-            static std::string serializeVariableUnsignedInt64 (std::uint64_t value)
+        private:
+            const ValueType * mData;
+            size_t mSize;
+        };
+
+        class PrimitiveEncoding
+        {
+        public:
+            static size_t sizeVariableInt32 (std::int32_t value)
             {
-                return serializeVariable<std::uint64_t>(value);
+                return sizeVariableInt64(value);
+            }
+            
+            static size_t sizeVariableUnsignedInt32 (std::uint32_t value)
+            {
+                return sizeVariableUnsignedInt64(value);
             }
 
-            static std::string serializeFloat (float value)
+            static size_t sizeVariableSignedInt32 (std::int32_t value)
             {
-                return serializeFixed<float>(value);
+                std::uint32_t unsignedValue = static_cast<std::uint32_t>(value);
+
+                unsignedValue = (unsignedValue << 1) ^ (value >> 31);
+
+                return sizeVariableUnsignedInt32(unsignedValue);
             }
 
-            static std::string serializeDouble (double value)
+            static size_t sizeVariableInt64 (std::int64_t value)
             {
-                return serializeFixed<double>(value);
+                return sizeVariableUnsignedInt64(static_cast<std::uint64_t>(value));
             }
 
-            static std::string serializeString (const std::string & value)
+            static size_t sizeVariableUnsignedInt64 (std::uint64_t value)
             {
-                return serializeBytes(value);
+                // Each byte holds 7 bits so the size is the index of the highest set bit divided by 7, plus one.
+                // Multiplying by 9 and dividing by 64 gives the same result for every bit index without a division.
+                return (highestBit(value | 1) * 9 + 73) / 64;
             }
 
-            static std::string serializeBytes (const std::string & value)
+            static size_t sizeVariableSignedInt64 (std::int64_t value)
             {
-                std::string result;
+                std::uint64_t unsignedValue = static_cast<std::uint64_t>(value);
 
-                result = serializeVariableUnsignedInt32(static_cast<std::uint32_t>(value.length()));
-                result += value;
+                unsignedValue = (unsignedValue << 1) ^ (value >> 63);
 
-                return result;
+                return sizeVariableUnsignedInt64(unsignedValue);
             }
 
-        private:
-            PrimitiveEncoding ()
-            {}
-
-            template <typename ValueType>
-            static ValueType parseVariable (const char * pData, size_t * pBytesParsed, bool useZigZag = false)
+            template <typename EnumType>
+            static size_t sizePackedVariableEnum (const EnumType * pValues, size_t count)
             {
-                if (pData == nullptr)
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i)
                 {
-                    throw std::invalid_argument("pData cannot be null.");
+                    result += sizeVariableUnsignedInt64(static_cast<std::uint64_t>(static_cast<std::int64_t>(pValues[i])));
                 }
 
-                ValueType rawValue = 0;
-                unsigned int byteCount = 0;
-                unsigned int maxByteCount = sizeof(ValueType) + sizeof(ValueType) / 4;
-                while (true)
-                {
-                    ValueType currentMaskedValue = *pData & 0x7f;
-                    currentMaskedValue = currentMaskedValue << byteCount * 7;
-                    rawValue |= currentMaskedValue;
-                    ++byteCount;
+                return result;
+            }
 
-                    bool lastByte = (*pData & 0x80) == 0;
-                    if (lastByte)
-                    {
-                        break;
-                    }
+            static size_t sizePackedVariableInt32 (const std::int32_t * pValues, size_t count)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result += sizeVariableUnsignedInt64(static_cast<std::uint64_t>(static_cast<std::int64_t>(pValues[i])));
+                }
 
-                    ++pData;
+                return result;
+            }
 
-                    if (byteCount == maxByteCount)
-                    {
-                        throw ProtocolBufferException("VarInt length exceeded maximum bytes.");
-                    }
+            static size_t sizePackedVariableInt64 (const std::int64_t * pValues, size_t count)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result += sizeVariableUnsignedInt64(static_cast<std::uint64_t>(pValues[i]));
                 }
 
-                if (pBytesParsed != nullptr)
+                return result;
+            }
+
+            static size_t sizePackedVariableUnsignedInt32 (const std::uint32_t * pValues, size_t count)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i)
                 {
-                    *pBytesParsed = byteCount;
+                    result += sizeVariableUnsignedInt64(pValues[i]);
                 }
 
+                return result;
+            }
+
+            static size_t sizePackedVariableUnsignedInt64 (const std::uint64_t * pValues, size_t count)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result += sizeVariableUnsignedInt64(pValues[i]);
+                }
+
+                return result;
+            }
+
+            static size_t sizePackedVariableSignedInt32 (const std::int32_t * pValues, size_t count)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result += sizeVariableUnsignedInt64(zigZag32(pValues[i]));
+                }
+
+                return result;
+            }
+
+            static size_t sizePackedVariableSignedInt64 (const std::int64_t * pValues, size_t count)
+            {
+                size_t result = 0;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result += sizeVariableUnsignedInt64(zigZag64(pValues[i]));
+                }
+
+                return result;
+            }
+
+            static std::int32_t parseVariableInt32 (const char * pData, size_t * pBytesParsed)
+            {
+                return parseVariableInt32(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::int32_t parseVariableInt32 (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return static_cast<std::int32_t>(parseVariable<std::int64_t>(pData, available, pBytesParsed));
+            }
+
+            static std::int64_t parseVariableInt64 (const char * pData, size_t * pBytesParsed)
+            {
+                return parseVariableInt64(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::int64_t parseVariableInt64 (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return parseVariable<std::int64_t>(pData, available, pBytesParsed);
+            }
+
+            static std::int32_t parseVariableSignedInt32 (const char * pData, size_t * pBytesParsed)
+            {
+                return parseVariableSignedInt32(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::int32_t parseVariableSignedInt32 (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return parseVariable<std::int32_t>(pData, available, pBytesParsed, true);
+            }
+
+            static std::int64_t parseVariableSignedInt64 (const char * pData, size_t * pBytesParsed)
+            {
+                return parseVariableSignedInt64(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::int64_t parseVariableSignedInt64 (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return parseVariable<std::int64_t>(pData, available, pBytesParsed, true);
+            }
+
+            static std::uint32_t parseVariableUnsignedInt32 (const char * pData, size_t * pBytesParsed)
+            {
+                return parseVariableUnsignedInt32(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::uint32_t parseVariableUnsignedInt32 (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return parseVariable<std::uint32_t>(pData, available, pBytesParsed);
+            }
+
+            static std::uint64_t parseVariableUnsignedInt64 (const char * pData, size_t * pBytesParsed)
+            {
+                return parseVariableUnsignedInt64(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::uint64_t parseVariableUnsignedInt64 (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return parseVariable<std::uint64_t>(pData, available, pBytesParsed);
+            }
+
+            static size_t countVariables (const char * pData, size_t length)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                // Every VarInt ends with exactly one byte that has its high bit clear. Eight bytes are
+                // checked at a time by collecting the inverted high bits and summing them with a multiply.
+                size_t result = 0;
+                size_t offset = 0;
+                for (; offset + 8 <= length; offset += 8)
+                {
+                    std::uint64_t word;
+                    std::memcpy(&word, pData + offset, 8);
+
+                    std::uint64_t lastBytes = (~word & 0x8080808080808080ULL) >> 7;
+                    result += static_cast<size_t>((lastBytes * 0x0101010101010101ULL) >> 56);
+                }
+                for (; offset < length; ++offset)
+                {
+                    if ((pData[offset] & 0x80) == 0)
+                    {
+                        ++result;
+                    }
+                }
+
+                return result;
+            }
+
+            static size_t parsePackedVariableInt32 (const char * pData, size_t length, std::int32_t * pValues, size_t maxValues, size_t * pBytesParsed)
+            {
+                return parsePackedVariable<std::int64_t>(pData, length, pValues, maxValues, pBytesParsed);
+            }
+
+            static size_t parsePackedVariableInt64 (const char * pData, size_t length, std::int64_t * pValues, size_t maxValues, size_t * pBytesParsed)
+            {
+                return parsePackedVariable<std::int64_t>(pData, length, pValues, maxValues, pBytesParsed);
+            }
+
+            static size_t parsePackedVariableSignedInt32 (const char * pData, size_t length, std::int32_t * pValues, size_t maxValues, size_t * pBytesParsed)
+            {
+                return parsePackedVariable<std::int32_t>(pData, length, pValues, maxValues, pBytesParsed, true);
+            }
+
+            static size_t parsePackedVariableSignedInt64 (const char * pData, size_t length, std::int64_t * pValues, size_t maxValues, size_t * pBytesParsed)
+            {
+                return parsePackedVariable<std::int64_t>(pData, length, pValues, maxValues, pBytesParsed, true);
+            }
+
+            static size_t parsePackedVariableUnsignedInt32 (const char * pData, size_t length, std::uint32_t * pValues, size_t maxValues, size_t * pBytesParsed)
+            {
+                return parsePackedVariable<std::uint32_t>(pData, length, pValues, maxValues, pBytesParsed);
+            }
+
+            template <typename EnumType>
+            static size_t parsePackedVariableEnum (const char * pData, size_t length, EnumType * pValues, size_t maxValues, size_t * pBytesParsed)
+            {
+                return parsePackedVariable<std::int64_t>(pData, length, pValues, maxValues, pBytesParsed);
+            }
+
+            static size_t parsePackedVariableUnsignedInt64 (const char * pData, size_t length, std::uint64_t * pValues, size_t maxValues, size_t * pBytesParsed)
+            {
+                return parsePackedVariable<std::uint64_t>(pData, length, pValues, maxValues, pBytesParsed);
+            }
+
+            static std::int32_t parseFixedInt32 (const char * pData)
+            {
+                return parseFixedInt32(pData, std::numeric_limits<size_t>::max());
+            }
+
+            static std::int32_t parseFixedInt32 (const char * pData, size_t available)
+            {
+                return parseFixed<std::int32_t>(pData, available);
+            }
+
+            static std::int64_t parseFixedInt64 (const char * pData)
+            {
+                return parseFixedInt64(pData, std::numeric_limits<size_t>::max());
+            }
+
+            static std::int64_t parseFixedInt64 (const char * pData, size_t available)
+            {
+                return parseFixed<std::int64_t>(pData, available);
+            }
+
+            static std::int32_t parseFixedSignedInt32 (const char * pData)
+            {
+                return parseFixedSignedInt32(pData, std::numeric_limits<size_t>::max());
+            }
+
+            static std::int32_t parseFixedSignedInt32 (const char * pData, size_t available)
+            {
+                return parseFixed<std::int32_t>(pData, available);
+            }
+
+            static std::int64_t parseFixedSignedInt64 (const char * pData)
+            {
+                return parseFixedSignedInt64(pData, std::numeric_limits<size_t>::max());
+            }
+
+            static std::int64_t parseFixedSignedInt64 (const char * pData, size_t available)
+            {
+                return parseFixed<std::int64_t>(pData, available);
+            }
+
+            static float parseFloat (const char * pData)
+            {
+                return parseFloat(pData, std::numeric_limits<size_t>::max());
+            }
+
+            static float parseFloat (const char * pData, size_t available)
+            {
+                return parseFixed<float>(pData, available);
+            }
+
+            static double parseDouble (const char * pData)
+            {
+                return parseDouble(pData, std::numeric_limits<size_t>::max());
+            }
+
+            static double parseDouble (const char * pData, size_t available)
+            {
+                return parseFixed<double>(pData, available);
+            }
+
+            static std::string parseString (const char * pData, size_t * pBytesParsed)
+            {
+                return parseString(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::string parseBytes (const char * pData, size_t * pBytesParsed)
+            {
+                return parseBytes(pData, std::numeric_limits<size_t>::max(), pBytesParsed);
+            }
+
+            static std::string parseString (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return parseBytes(pData, available, pBytesParsed);
+            }
+
+            static std::string parseBytes (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                return parseBytesView(pData, available, pBytesParsed).toString();
+            }
+
+            static ByteView parseBytesView (const char * pData, size_t available, size_t * pBytesParsed)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                size_t bytesParsed = 0;
+                std::uint32_t length = parseVariableUnsignedInt32(pData, available, &bytesParsed);
+                pData += bytesParsed;
+
+                if (length > available - bytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
+                ByteView result(pData, length);
+
+                if (pBytesParsed != nullptr)
+                {
+                    *pBytesParsed = bytesParsed + length;
+                }
+
+                return result;
+            }
+
+            static std::string serializeVariableInt32 (std::int32_t value)
+            {
+                return serializeVariable<std::int64_t>(value);
+            }
+
+            static char * serializeVariableInt32 (std::int32_t value, char * pData)
+            {
+                return serializeVariable<std::int64_t>(value, pData);
+            }
+
+            static std::string serializeFixedInt32 (std::int32_t value)
+            {
+                return serializeFixed<std::int32_t>(value);
+            }
+
+            static char * serializeFixedInt32 (std::int32_t value, char * pData)
+            {
+                return serializeFixed<std::int32_t>(value, pData);
+            }
+
+            static std::string serializeVariableInt64 (std::int64_t value)
+            {
+                return serializeVariable<std::int64_t>(value);
+            }
+
+            static char * serializeVariableInt64 (std::int64_t value, char * pData)
+            {
+                return serializeVariable<std::int64_t>(value, pData);
+            }
+
+            static std::string serializeFixedInt64 (std::int64_t value)
+            {
+                return serializeFixed<std::int64_t>(value);
+            }
+
+            static char * serializeFixedInt64 (std::int64_t value, char * pData)
+            {
+                return serializeFixed<std::int64_t>(value, pData);
+            }
+
+            static std::string serializeVariableSignedInt32 (std::int32_t value)
+            {
+                return serializeVariable<std::int32_t>(value, true);
+            }
+
+            static char * serializeVariableSignedInt32 (std::int32_t value, char * pData)
+            {
+                return serializeVariable<std::int32_t>(value, pData, true);
+            }
+
+            static std::string serializeFixedSignedInt32 (std::int32_t value)
+            {
+                return serializeFixed<std::int32_t>(value);
+            }
+
+            static char * serializeFixedSignedInt32 (std::int32_t value, char * pData)
+            {
+                return serializeFixed<std::int32_t>(value, pData);
+            }
+
+            static std::string serializeVariableSignedInt64 (std::int64_t value)
+            {
+                return serializeVariable<std::int64_t>(value, true);
+            }
+
+            static char * serializeVariableSignedInt64 (std::int64_t value, char * pData)
+            {
+                return serializeVariable<std::int64_t>(value, pData, true);
+            }
+
+            static std::string serializeFixedSignedInt64 (std::int64_t value)
+            {
+                return serializeFixed<std::int64_t>(value);
+            }
+
+            static char * serializeFixedSignedInt64 (std::int64_t value, char * pData)
+            {
+                return serializeFixed<std::int64_t>(value, pData);
+            }
+
+            static std::string serializeVariableUnsignedInt32 (std::uint32_t value)
+            {
+                return serializeVariable<std::uint32_t>(value);
+            }
+
+            static char * serializeVariableUnsignedInt32 (std::uint32_t value, char * pData)
+            {
+                return serializeVariable<std::uint32_t>(value, pData);
+            }
+
+            static std::string serializeVariableUnsignedInt64 (std::uint64_t value)
+            {
+                return serializeVariable<std::uint64_t>(value);
+            }
+
+            static char * serializeVariableUnsignedInt64 (std::uint64_t value, char * pData)
+            {
+                return serializeVariable<std::uint64_t>(value, pData);
+            }
+
+            static char * serializePackedVariableInt32 (const std::int32_t * pValues, size_t count, char * pData)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pData = serializeVariable<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::int64_t>(pValues[i])), pData);
+                }
+
+                return pData;
+            }
+
+            static char * serializePackedVariableInt64 (const std::int64_t * pValues, size_t count, char * pData)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pData = serializeVariable<std::uint64_t>(static_cast<std::uint64_t>(pValues[i]), pData);
+                }
+
+                return pData;
+            }
+
+            static char * serializePackedVariableUnsignedInt32 (const std::uint32_t * pValues, size_t count, char * pData)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pData = serializeVariable<std::uint64_t>(pValues[i], pData);
+                }
+
+                return pData;
+            }
+
+            static char * serializePackedVariableUnsignedInt64 (const std::uint64_t * pValues, size_t count, char * pData)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pData = serializeVariable<std::uint64_t>(pValues[i], pData);
+                }
+
+                return pData;
+            }
+
+            static char * serializePackedVariableSignedInt32 (const std::int32_t * pValues, size_t count, char * pData)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pData = serializeVariable<std::uint64_t>(zigZag32(pValues[i]), pData);
+                }
+
+                return pData;
+            }
+
+            static char * serializePackedVariableSignedInt64 (const std::int64_t * pValues, size_t count, char * pData)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pData = serializeVariable<std::uint64_t>(zigZag64(pValues[i]), pData);
+                }
+
+                return pData;
+            }
+
+            template <typename EnumType>
+            static char * serializePackedVariableEnum (const EnumType * pValues, size_t count, char * pData)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pData = serializeVariable<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::int64_t>(pValues[i])), pData);
+                }
+
+                return pData;
+            }
+
+            static char * serializePackedBool (const std::uint8_t * pValues, size_t count, char * pData)
+            {
+                if (count != 0)
+                {
+                    std::memcpy(pData, pValues, count);
+                }
+
+                return pData + count;
+            }
+
+            static std::string serializeFloat (float value)
+            {
+                return serializeFixed<float>(value);
+            }
+
+            static char * serializeFloat (float value, char * pData)
+            {
+                return serializeFixed<float>(value, pData);
+            }
+
+            static std::string serializeDouble (double value)
+            {
+                return serializeFixed<double>(value);
+            }
+
+            static char * serializeDouble (double value, char * pData)
+            {
+                return serializeFixed<double>(value, pData);
+            }
+
+            static std::string serializeString (const std::string & value)
+            {
+                return serializeBytes(value);
+            }
+
+            static char * serializeString (const std::string & value, char * pData)
+            {
+                return serializeBytes(value, pData);
+            }
+
+            static std::string serializeBytes (const std::string & value)
+            {
+                std::string result;
+
+                result = serializeVariableUnsignedInt32(static_cast<std::uint32_t>(value.length()));
+                result += value;
+
+                return result;
+            }
+
+            static char * serializeBytes (const ByteView & value, char * pData)
+            {
+                pData = serializeVariableUnsignedInt32(static_cast<std::uint32_t>(value.size()), pData);
+
+                if (!value.empty())
+                {
+                    std::memcpy(pData, value.data(), value.size());
+                }
+
+                return pData + value.size();
+            }
+
+        private:
+            PrimitiveEncoding ()
+            {}
+
+            static unsigned int highestBit (std::uint64_t value)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return 63 - static_cast<unsigned int>(__builtin_clzll(value));
+#else
+                unsigned int result = 0;
+                for (unsigned int shift = 32; shift != 0; shift /= 2)
+                {
+                    if (value >> shift)
+                    {
+                        value = value >> shift;
+                        result += shift;
+                    }
+                }
+
+                return result;
+#endif
+            }
+
+            static std::uint64_t zigZag32 (std::int32_t value)
+            {
+                std::uint32_t unsignedValue = static_cast<std::uint32_t>(value);
+
+                return (unsignedValue << 1) ^ (static_cast<std::uint32_t>(0) - (unsignedValue >> 31));
+            }
+
+            static std::uint64_t zigZag64 (std::int64_t value)
+            {
+                std::uint64_t unsignedValue = static_cast<std::uint64_t>(value);
+
+                return (unsignedValue << 1) ^ (static_cast<std::uint64_t>(0) - (unsignedValue >> 63));
+            }
+
+            template <typename ValueType>
+            static ValueType parseVariable (const char * pData, size_t available, size_t * pBytesParsed, bool useZigZag = false)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                typedef typename std::make_unsigned<ValueType>::type UnsignedType;
+
+                size_t byteCount = 0;
+                unsigned int maxByteCount = sizeof(ValueType) + sizeof(ValueType) / 4;
+                UnsignedType rawValue = static_cast<UnsignedType>(decodeVariable(pData, available, maxByteCount, &byteCount));
+
+                if (pBytesParsed != nullptr)
+                {
+                    *pBytesParsed = byteCount;
+                }
+
+                if (useZigZag)
+                {
+                    rawValue = (rawValue >> 1) ^ (static_cast<UnsignedType>(0) - (rawValue & 1));
+                }
+
+                return static_cast<ValueType>(rawValue);
+            }
+
+            static std::uint64_t decodeVariable (const char * pData, size_t available, unsigned int maxByteCount, size_t * pBytesParsed)
+            {
+                const unsigned char * pBytes = reinterpret_cast<const unsigned char *>(pData);
+
+                // Most values fit in a single byte so they return before any loop setup.
+                if (available != 0 && pBytes[0] < 0x80)
+                {
+                    *pBytesParsed = 1;
+                    return pBytes[0];
+                }
+
+                // The loop limit already accounts for the available data so each byte only needs its continuation bit checked.
+                size_t byteLimit = available < maxByteCount ? available : maxByteCount;
+                std::uint64_t result = 0;
+                for (size_t byteCount = 0; byteCount < byteLimit; ++byteCount)
+                {
+                    std::uint64_t currentByte = pBytes[byteCount];
+                    result |= (currentByte & 0x7f) << (byteCount * 7);
+
+                    if (currentByte < 0x80)
+                    {
+                        *pBytesParsed = byteCount + 1;
+                        return result;
+                    }
+                }
+
+                if (byteLimit == maxByteCount)
+                {
+                    throw ProtocolBufferException("VarInt length exceeded maximum bytes.");
+                }
+
+                throw ProtocolBufferException("VarInt exceeds available data.");
+            }
+
+            template <typename DecodedType, typename ValueType>
+            static size_t parsePackedVariable (const char * pData, size_t length, ValueType * pValues, size_t maxValues, size_t * pBytesParsed, bool useZigZag = false)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                size_t valueCount = 0;
+                size_t offset = 0;
+                while (offset < length && valueCount < maxValues)
+                {
+                    size_t bytesParsed = 0;
+                    pValues[valueCount] = static_cast<ValueType>(parseVariable<DecodedType>(pData + offset, length - offset, &bytesParsed, useZigZag));
+
+                    ++valueCount;
+                    offset += bytesParsed;
+                }
+
+                if (pBytesParsed != nullptr)
+                {
+                    *pBytesParsed = offset;
+                }
+
+                return valueCount;
+            }
+
+            template <typename ValueType>
+            static ValueType parseFixed (const char * pData, size_t available)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                if (available < sizeof(ValueType))
+                {
+                    throw ProtocolBufferException("Fixed value exceeds available data.");
+                }
+
+                ValueType value = 0;
+                char * pValueChars = reinterpret_cast<char *>(&value);
+                for (int i = sizeof(ValueType) - 1; i >= 0; --i)
+                {
+                    pValueChars[i] = *pData;
+                    ++pData;
+                }
+
+                return value;
+            }
+
+            template <typename ValueType>
+            static std::string serializeVariable (ValueType value, bool useZigZag = false)
+            {
+                char buffer[10];
+                char * pEnd = serializeVariable<ValueType>(value, buffer, useZigZag);
+
+                return std::string(buffer, pEnd);
+            }
+
+            template <typename ValueType>
+            static char * serializeVariable (ValueType value, char * pData, bool useZigZag = false)
+            {
+                typename std::make_unsigned<ValueType>::type unsignedValue =
+                    static_cast<typename std::make_unsigned<ValueType>::type>(value);
+
                 if (useZigZag)
                 {
-                    typename std::make_unsigned<ValueType>::type unsignedValue =
-                        static_cast<typename std::make_unsigned<ValueType>::type>(rawValue);
-                    typename std::make_signed<ValueType>::type signedValue =
-                        static_cast<typename std::make_signed<ValueType>::type>(rawValue);
+                    typename std::make_signed<ValueType>::type signedValue =
+                        static_cast<typename std::make_signed<ValueType>::type>(value);
+
+                    int shiftAmount = sizeof(ValueType) * 8 - 1;
+                    unsignedValue = (unsignedValue << 1) ^ (signedValue >> shiftAmount);
+                }
+
+                while (unsignedValue >= 0x80)
+                {
+                    *pData = static_cast<char>(unsignedValue | 0x80);
+                    ++pData;
+
+                    unsignedValue = unsignedValue >> 7;
+                }
+                *pData = static_cast<char>(unsignedValue);
+
+                return pData + 1;
+            }
+
+            template <typename ValueType>
+            static std::string serializeFixed (ValueType value)
+            {
+                char buffer[sizeof(ValueType)];
+                char * pEnd = serializeFixed<ValueType>(value, buffer);
+
+                return std::string(buffer, pEnd);
+            }
+
+            template <typename ValueType>
+            static char * serializeFixed (ValueType value, char * pData)
+            {
+                char * pValueChars = reinterpret_cast<char *>(&value);
+                for (int i = sizeof(ValueType) - 1; i >= 0; --i)
+                {
+                    *pData = pValueChars[i];
+                    ++pData;
+                }
+
+                return pData;
+            }
+        };
+
+        // Keeps fields that a message does not recognize as their original key and value bytes so they can be
+        // written back out unchanged. This lets code built against an older schema forward newer fields.
+        class UnknownFields
+        {
+        public:
+            // Parses the value of an unknown field whose key has already been parsed and appends the key and the
+            // value bytes to pUnknownFields. pData points to the value. Returns the value bytes parsed.
+            static size_t parse (std::uint32_t fieldKey, const char * pData, size_t available, std::string * pUnknownFields)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                size_t bytesParsed = 0;
+                switch (fieldKey & 0x07)
+                {
+                    case 0:
+                        PrimitiveEncoding::parseVariableUnsignedInt64(pData, available, &bytesParsed);
+                        break;
+
+                    case 1:
+                        bytesParsed = 8;
+                        break;
+
+                    case 2:
+                    {
+                        size_t lengthBytesParsed = 0;
+                        std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
+                        bytesParsed = lengthBytesParsed + length;
+                        break;
+                    }
+
+                    case 5:
+                        bytesParsed = 4;
+                        break;
+
+                    default:
+                        throw ProtocolBufferException("Unsupported wire type.");
+                }
+
+                if (bytesParsed > available)
+                {
+                    throw ProtocolBufferException("Field exceeds available data.");
+                }
+
+                if (pUnknownFields != nullptr)
+                {
+                    char keyBuffer[5];
+                    char * pKeyEnd = PrimitiveEncoding::serializeVariableUnsignedInt32(fieldKey, keyBuffer);
+                    pUnknownFields->append(keyBuffer, pKeyEnd - keyBuffer);
+                    pUnknownFields->append(pData, bytesParsed);
+                }
+
+                return bytesParsed;
+            }
+
+            static char * writeTo (const std::string & unknownFields, char * pData)
+            {
+                if (unknownFields.empty())
+                {
+                    return pData;
+                }
+
+                std::memcpy(pData, unknownFields.data(), unknownFields.size());
+
+                return pData + unknownFields.size();
+            }
+        };
+
+        // Used as the default type of fields that have no default value, such as messages and repeated fields.
+        struct NoDefault
+        {
+        };
+
+        // Describes one field of a message. Everything here is the same for every instance of the message,
+        // so the generated data holds one static descriptor per field and the fields only hold their values.
+        template <typename DefaultType>
+        struct FieldDescriptor
+        {
+            unsigned int index;
+            unsigned int wireType;
+            bool required;
+            DefaultType defaultValue;
+        };
+
+        class ProtoBase
+        {
+        public:
+            virtual ~ProtoBase ()
+            {}
+
+            unsigned int index () const
+            {
+                return mIndex;
+            }
+
+            void setIndex (unsigned int index)
+            {
+                mIndex = index;
+            }
+
+            virtual unsigned int key () const = 0;
+
+            // The tag is the encoded key that the generated message precomputes for each of its fields. When there
+            // is no tag, the key is encoded from the index instead.
+            char * writeKeyTo (char * pData, const char * pTag, unsigned int tagSize) const
+            {
+                if (tagSize == 0)
+                {
+                    return PrimitiveEncoding::serializeVariableUnsignedInt32(key(), pData);
+                }
+
+                std::memcpy(pData, pTag, tagSize);
+
+                return pData + tagSize;
+            }
+
+            size_t keyByteSize (unsigned int tagSize) const
+            {
+                if (tagSize == 0)
+                {
+                    return PrimitiveEncoding::sizeVariableUnsignedInt32(key());
+                }
+
+                return tagSize;
+            }
+
+            size_t parse (const char * pData)
+            {
+                return parse(pData, std::numeric_limits<size_t>::max());
+            }
+
+            virtual size_t parse (const char * pData, size_t available) = 0;
+
+            // Parses like parse but string and bytes values may refer directly into pData instead of
+            // copying it. The caller must keep the buffer alive and unchanged while those values are in use.
+            virtual size_t parseAliased (const char * pData, size_t available)
+            {
+                return parse(pData, available);
+            }
+
+            std::string serialize () const
+            {
+                std::string result;
+
+                serializeTo(result);
+
+                return result;
+            }
+
+            void serializeTo (std::string & output) const
+            {
+                size_t size = byteSize();
+                if (size == 0)
+                {
+                    return;
+                }
+
+                size_t offset = output.size();
+                output.resize(offset + size);
+
+                writeTo(&output[offset]);
+            }
+
+            size_t serializeToArray (char * pData, size_t available) const
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                size_t size = byteSize();
+                if (size > available)
+                {
+                    throw ProtocolBufferException("Serialized size exceeds available space.");
+                }
+
+                writeTo(pData);
+
+                return size;
+            }
+
+            char * writeTo (char * pData) const
+            {
+                return writeTo(pData, nullptr, 0);
+            }
+
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const = 0;
+
+            size_t byteSize () const
+            {
+                return byteSize(0);
+            }
+
+            virtual size_t byteSize (unsigned int tagSize) const = 0;
+
+            // Whether required fields are present is checked by the message against its presence bits.
+            virtual bool valid () const
+            {
+                return true;
+            }
+
+        protected:
+            ProtoBase ()
+            : mIndex(0)
+            {}
+
+            ProtoBase (const ProtoBase & src)
+            : mIndex(src.mIndex)
+            {
+            }
+
+            ProtoBase (ProtoBase && src) noexcept
+            : mIndex(src.mIndex)
+            {
+            }
+
+            ProtoBase & operator = (const ProtoBase & rhs)
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                mIndex = rhs.mIndex;
+
+                return *this;
+            }
+
+            ProtoBase & operator = (ProtoBase && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                mIndex = rhs.mIndex;
+
+                return *this;
+            }
+
+        private:
+            unsigned int mIndex;
+        };
+
+        class ProtoMessage : public ProtoBase
+        {
+        public:
+            virtual unsigned int key () const
+            {
+                return (this->index() << 3) | 0x02;
+            }
+
+            // Parses the value of a single field whose key has already been parsed. pData points to the value.
+            // Returns the value bytes parsed. This lets a message be filled in one field at a time.
+            virtual size_t parseField (std::uint32_t fieldKey, const char * pData, size_t available, bool aliased) = 0;
+
+        protected:
+            ProtoMessage ()
+            {}
+        };
+
+        // Parses a message that arrives in pieces, such as the buffers filled by successive socket reads. Each piece
+        // can end anywhere, even in the middle of a VarInt or a string. A field that is contained in one piece is
+        // parsed straight from it. Only a field that is split across pieces is copied until the rest of it arrives.
+        class IncrementalParser
+        {
+        public:
+            explicit IncrementalParser (ProtoMessage & message)
+            : mMessage(message), mState(State::length), mRemainingBytes(0), mFieldKey(0), mFieldSize(0)
+            {}
+
+            // Parses as much of the piece as belongs to the message and returns the bytes used. This is less than
+            // available only when the message is complete before the end of the piece.
+            size_t parse (const char * pData, size_t available)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
 
-                    int shiftAmount = sizeof(ValueType) * 8 - 1;
-                    return (unsignedValue >> 1) ^ ((signedValue << shiftAmount) >> shiftAmount);
+                const char * pStart = pData;
+                while (available != 0 && mState != State::complete)
+                {
+                    size_t bytesParsed = 0;
+                    if (mState == State::length)
+                    {
+                        bytesParsed = parseLength(pData, available);
+                    }
+                    else
+                    {
+                        size_t fieldAvailable = available < mRemainingBytes ? available : mRemainingBytes;
+                        if (mState == State::key)
+                        {
+                            bytesParsed = parseKey(pData, fieldAvailable);
+                        }
+                        else
+                        {
+                            bytesParsed = parseValue(pData, fieldAvailable);
+                        }
+
+                        mRemainingBytes -= bytesParsed;
+                        if (mRemainingBytes == 0)
+                        {
+                            if (mState != State::key || !mPending.empty())
+                            {
+                                throw ProtocolBufferException("Field exceeds available data.");
+                            }
+                            mState = State::complete;
+                        }
+                    }
+
+                    pData += bytesParsed;
+                    available -= bytesParsed;
                 }
-                else
+
+                return pData - pStart;
+            }
+
+            bool complete () const
+            {
+                return mState == State::complete;
+            }
+
+            // Prepares to parse another message into the same message object.
+            void reset ()
+            {
+                mState = State::length;
+                mRemainingBytes = 0;
+                mFieldKey = 0;
+                mFieldSize = 0;
+                mPending.clear();
+            }
+
+        private:
+            enum class State
+            {
+                length,
+                key,
+                value,
+                complete
+            };
+
+            IncrementalParser (const IncrementalParser & src) = delete;
+            IncrementalParser & operator = (const IncrementalParser & rhs) = delete;
+
+            size_t parseLength (const char * pData, size_t available)
+            {
+                size_t bytesUsed = 0;
+                size_t variableSize = 0;
+                const char * pVariable = variable(pData, available, &bytesUsed, &variableSize);
+                if (pVariable != nullptr)
                 {
-                    return rawValue;
+                    size_t lengthBytesParsed = 0;
+                    mRemainingBytes = PrimitiveEncoding::parseVariableUnsignedInt32(pVariable, variableSize, &lengthBytesParsed);
+                    mPending.clear();
+                    mState = mRemainingBytes == 0 ? State::complete : State::key;
                 }
+                return bytesUsed;
             }
 
-            template <typename ValueType>
-            static ValueType parseFixed (const char * pData)
+            size_t parseKey (const char * pData, size_t available)
             {
-                if (pData == nullptr)
+                size_t bytesUsed = 0;
+                size_t variableSize = 0;
+                const char * pVariable = variable(pData, available, &bytesUsed, &variableSize);
+                if (pVariable != nullptr)
                 {
-                    throw std::invalid_argument("pData cannot be null.");
+                    size_t keyBytesParsed = 0;
+                    mFieldKey = PrimitiveEncoding::parseVariableUnsignedInt32(pVariable, variableSize, &keyBytesParsed);
+                    mPending.clear();
+                    mState = State::value;
                 }
+                return bytesUsed;
+            }
 
-                ValueType value = 0;
-                char * pValueChars = reinterpret_cast<char *>(&value);
-                for (int i = sizeof(ValueType) - 1; i >= 0; --i)
+            size_t parseValue (const char * pData, size_t available)
+            {
+                size_t bytesUsed = 0;
+                if (mFieldSize == 0)
                 {
-                    pValueChars[i] = *pData;
-                    ++pData;
+                    switch (mFieldKey & 0x07)
+                    {
+                        case 0:
+                        {
+                            size_t variableSize = 0;
+                            const char * pVariable = variable(pData, available, &bytesUsed, &variableSize);
+                            if (pVariable != nullptr)
+                            {
+                                finishField(pVariable, variableSize);
+                            }
+                            return bytesUsed;
+                        }
+
+                        case 1:
+                            mFieldSize = 8;
+                            break;
+
+                        case 2:
+                        {
+                            size_t variableSize = 0;
+                            const char * pVariable = variable(pData, available, &bytesUsed, &variableSize);
+                            if (pVariable == nullptr)
+                            {
+                                return bytesUsed;
+                            }
+
+                            size_t lengthBytesParsed = 0;
+                            std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pVariable, variableSize, &lengthBytesParsed);
+                            mFieldSize = variableSize + length;
+
+                            if (pVariable == pData)
+                            {
+                                if (available >= mFieldSize)
+                                {
+                                    size_t fieldSize = mFieldSize;
+                                    finishField(pData, fieldSize);
+                                    return fieldSize;
+                                }
+                                // The length was read straight from the piece so it has to be kept with the value.
+                                mPending.assign(pData, variableSize);
+                            }
+                            pData += bytesUsed;
+                            available -= bytesUsed;
+                            break;
+                        }
+
+                        case 5:
+                            mFieldSize = 4;
+                            break;
+
+                        default:
+                            throw ProtocolBufferException("Unsupported wire type.");
+                    }
                 }
 
-                return value;
+                if (mPending.empty() && available >= mFieldSize)
+                {
+                    size_t fieldSize = mFieldSize;
+                    finishField(pData, fieldSize);
+                    return bytesUsed + fieldSize;
+                }
+
+                size_t copySize = mFieldSize - mPending.size();
+                if (copySize > available)
+                {
+                    copySize = available;
+                }
+                mPending.append(pData, copySize);
+                bytesUsed += copySize;
+
+                if (mPending.size() == mFieldSize)
+                {
+                    finishField(mPending.data(), mFieldSize);
+                }
+                return bytesUsed;
             }
 
-            template <typename ValueType>
-            static std::string serializeVariable (ValueType value, bool useZigZag = false)
+            // Finds the end of a VarInt. Returns the start of the complete VarInt, which is either in the piece or
+            // in the pending bytes when it was split. Returns nullptr and keeps the bytes when it is not complete yet.
+            const char * variable (const char * pData, size_t available, size_t * pBytesUsed, size_t * pVariableSize)
             {
-                typename std::make_unsigned<ValueType>::type unsignedValue =
-                    static_cast<typename std::make_unsigned<ValueType>::type>(value);
+                size_t end = 0;
+                while (end < available && (pData[end] & 0x80) != 0)
+                {
+                    ++end;
+                }
 
-                if (useZigZag)
+                if (end == available)
                 {
-                    typename std::make_signed<ValueType>::type signedValue =
-                        static_cast<typename std::make_signed<ValueType>::type>(value);
+                    mPending.append(pData, available);
+                    if (mPending.size() >= 10)
+                    {
+                        throw ProtocolBufferException("VarInt is too long.");
+                    }
+                    *pBytesUsed = available;
+                    return nullptr;
+                }
 
-                    int shiftAmount = sizeof(ValueType) * 8 - 1;
-                    unsignedValue = (unsignedValue << 1) ^ (signedValue >> shiftAmount);
+                *pBytesUsed = end + 1;
+                if (mPending.empty())
+                {
+                    *pVariableSize = end + 1;
+                    return pData;
                 }
-                std::string result;
-                bool lastByte = false;
-                while (!lastByte)
+
+                mPending.append(pData, end + 1);
+                *pVariableSize = mPending.size();
+                return mPending.data();
+            }
+
+            void finishField (const char * pData, size_t size)
+            {
+                size_t bytesParsed = mMessage.parseField(mFieldKey, pData, size, false);
+                if (bytesParsed != size)
                 {
-                    char currentByte = unsignedValue & 0x7f;
+                    throw ProtocolBufferException("Field size does not match its contents.");
+                }
 
-                    unsignedValue = unsignedValue >> 7;
-                    if (unsignedValue == 0)
+                mPending.clear();
+                mFieldSize = 0;
+                mState = State::key;
+            }
+
+            ProtoMessage & mMessage;
+            State mState;
+            size_t mRemainingBytes;
+            std::uint32_t mFieldKey;
+            size_t mFieldSize;
+            std::string mPending;
+        };
+
+        // Writes messages back to back to a stream. Each message already starts with its length so no other framing
+        // is needed. Messages are collected in a block and the block is written to the stream when it fills up.
+        class DelimitedWriter
+        {
+        public:
+            explicit DelimitedWriter (std::ostream & stream, size_t blockSize = 64 * 1024)
+            : mStream(stream), mBuffer(blockSize), mUsed(0)
+            {}
+
+            ~DelimitedWriter ()
+            {
+                if (mUsed != 0)
+                {
+                    mStream.write(mBuffer.data(), mUsed);
+                }
+            }
+
+            void write (const ProtoMessage & message)
+            {
+                size_t size = message.byteSize();
+                if (size > mBuffer.size() - mUsed)
+                {
+                    flush();
+                    if (size > mBuffer.size())
                     {
-                        lastByte = true;
+                        mBuffer.resize(size);
                     }
-                    else
+                }
+
+                message.writeTo(&mBuffer[mUsed]);
+                mUsed += size;
+            }
+
+            void flush ()
+            {
+                if (mUsed != 0)
+                {
+                    mStream.write(mBuffer.data(), mUsed);
+                    mUsed = 0;
+                }
+                mStream.flush();
+
+                if (!mStream)
+                {
+                    throw ProtocolBufferException("Unable to write to stream.");
+                }
+            }
+
+        private:
+            DelimitedWriter (const DelimitedWriter & src) = delete;
+            DelimitedWriter & operator = (const DelimitedWriter & rhs) = delete;
+
+            std::ostream & mStream;
+            std::vector<char> mBuffer;
+            size_t mUsed;
+        };
+
+        // Reads messages written by DelimitedWriter. The stream is read in blocks and the same message object is
+        // cleared and filled for each message, so a message returned by message() or the iterator is only valid
+        // until the next one is read. Copy it to keep it longer.
+        template <typename MessageType>
+        class DelimitedReader
+        {
+        public:
+            class iterator
+            {
+            public:
+                explicit iterator (DelimitedReader * pReader)
+                : mReader(pReader)
+                {
+                    if (mReader != nullptr && !mReader->next())
+                    {
+                        mReader = nullptr;
+                    }
+                }
+
+                const MessageType & operator * () const
+                {
+                    return mReader->message();
+                }
+
+                const MessageType * operator -> () const
+                {
+                    return &mReader->message();
+                }
+
+                iterator & operator ++ ()
+                {
+                    if (!mReader->next())
                     {
-                        currentByte |= 0x80;
+                        mReader = nullptr;
                     }
+                    return *this;
+                }
 
-                    result += currentByte;
+                bool operator == (const iterator & rhs) const
+                {
+                    return mReader == rhs.mReader;
                 }
-                
-                return result;
-            }
 
-            template <typename ValueType>
-            static std::string serializeFixed (ValueType value)
+                bool operator != (const iterator & rhs) const
+                {
+                    return mReader != rhs.mReader;
+                }
+
+            private:
+                DelimitedReader * mReader;
+            };
+
+            explicit DelimitedReader (std::istream & stream, size_t blockSize = 64 * 1024)
+            : mStream(stream), mBuffer(blockSize), mStart(0), mEnd(0)
+            {}
+
+            // Reads the next message. Returns false at the end of the stream.
+            bool next ()
             {
-                std::string result;
-                char * pValueChars = reinterpret_cast<char *>(&value);
-                for (int i = sizeof(ValueType) - 1; i >= 0; --i)
+                mMessage.clear();
+                IncrementalParser parser(mMessage);
+
+                bool started = false;
+                while (true)
                 {
-                    result += pValueChars[i];
+                    if (mStart == mEnd && !fill())
+                    {
+                        if (started)
+                        {
+                            throw ProtocolBufferException("Stream ended in the middle of a message.");
+                        }
+                        return false;
+                    }
+                    started = true;
+
+                    mStart += parser.parse(&mBuffer[mStart], mEnd - mStart);
+                    if (parser.complete())
+                    {
+                        return true;
+                    }
                 }
+            }
 
-                return result;
+            const MessageType & message () const
+            {
+                return mMessage;
+            }
+
+            iterator begin ()
+            {
+                return iterator(this);
+            }
+
+            iterator end ()
+            {
+                return iterator(nullptr);
+            }
+
+        private:
+            DelimitedReader (const DelimitedReader & src) = delete;
+            DelimitedReader & operator = (const DelimitedReader & rhs) = delete;
+
+            bool fill ()
+            {
+                mStream.read(&mBuffer[0], mBuffer.size());
+                mStart = 0;
+                mEnd = static_cast<size_t>(mStream.gcount());
+                return mEnd != 0;
             }
+
+            std::istream & mStream;
+            std::vector<char> mBuffer;
+            size_t mStart;
+            size_t mEnd;
+            MessageType mMessage;
         };
 
-        class ProtoBase
+        template <typename MessageType>
+        class ProtoMessageField final : public ProtoBase
         {
         public:
-            virtual ~ProtoBase ()
+            explicit ProtoMessageField ()
+            : mArena(nullptr)
+            {}
+
+            ProtoMessageField (const ProtoMessageField & src)
+            : ProtoBase(src), mValue(src.mValue), mArena(src.mArena)
+            {}
+
+            ProtoMessageField (ProtoMessageField && src) noexcept
+            : ProtoBase(std::move(src)), mValue(std::move(src.mValue)), mArena(src.mArena)
             {}
 
-            virtual unsigned int index () const
+            void setArena (Arena * pArena)
             {
-                return mIndex;
+                mArena = pArena;
             }
 
-            virtual void setIndex (unsigned int index)
+            const MessageType & value () const
             {
-                mIndex = index;
+                return *mValue;
+            }
+
+            void setValue (const MessageType & message)
+            {
+                std::shared_ptr<MessageType> newValue = makeShared<MessageType>(mArena, message);
+
+                newValue->setIndex(this->index());
+
+                mValue = newValue;
             }
 
-            virtual bool required () const
+            void setValue (MessageType && message)
             {
-                return mRequired;
+                std::shared_ptr<MessageType> newValue = makeShared<MessageType>(mArena, std::move(message));
+
+                newValue->setIndex(this->index());
+
+                mValue = newValue;
             }
 
-            virtual void setRequired (bool required)
+            MessageType & createNewValue ()
             {
-                mRequired = required;
+                mValue = emptyValue();
+
+                return *mValue;
             }
 
-            virtual unsigned int key () const = 0;
+            // Returns the value for changing in place, creating it if needed. The value can be shared with copies of
+            // the field so a shared value is copied first, including the data of a message that shares its data.
+            MessageType & mutableValue ()
+            {
+                if (mValue == nullptr)
+                {
+                    return createNewValue();
+                }
+                if (mValue.use_count() > 1)
+                {
+                    mValue = makeShared<MessageType>(mArena, mValue->deepCopy());
+                }
+                return *mValue;
+            }
+
+            virtual unsigned int key () const
+            {
+                return mValue->key();
+            }
 
-            virtual size_t parse (const char * pData) = 0;
+            virtual size_t parse (const char * pData, size_t available)
+            {
+                mValue = emptyValue();
 
-            virtual std::string serialize () const = 0;
+                return mValue->parse(pData, available);
+            }
 
-            virtual size_t byteSize () const = 0;
+            virtual size_t parseAliased (const char * pData, size_t available)
+            {
+                mValue = emptyValue();
 
-            virtual bool valid () const
+                return mValue->parseAliased(pData, available);
+            }
+
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                if (required() && !hasValue())
+                if (!this->hasValue())
                 {
-                    return false;
+                    return pData;
                 }
-                return true;
+                return mValue->writeTo(pData, pTag, tagSize);
             }
 
-        protected:
-            ProtoBase ()
-            : mIndex(0), mHasValue(false), mRequired(false)
-            {}
+            virtual size_t byteSize (unsigned int tagSize) const
+            {
+                if (!this->hasValue())
+                {
+                    return 0;
+                }
+                return mValue->byteSize(tagSize);
+            }
 
-            ProtoBase (const ProtoBase & src)
-            : mIndex(src.mIndex), mHasValue(src.mHasValue), mRequired(src.mRequired)
+            bool hasValue () const
             {
+                return mValue != nullptr;
             }
 
-            virtual bool hasValue () const
+            // A value that nothing else refers to is kept so that it can be cleared and used again.
+            void clearValue ()
             {
-                return mHasValue;
+                if (mValue.use_count() == 1)
+                {
+                    mSpare = std::move(mValue);
+                }
+                mValue = nullptr;
             }
 
-            virtual void setValue ()
+            virtual bool valid () const
             {
-                mHasValue = true;
+                if (hasValue())
+                {
+                    return mValue->valid();
+                }
+                return true;
             }
 
-            virtual void clearValue ()
-            {
-                mHasValue = false;
+            ProtoMessageField & operator = (const ProtoMessageField & rhs)
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(rhs);
+                
+                mValue = rhs.mValue;
+                mArena = rhs.mArena;
+
+                return *this;
             }
 
-            ProtoBase & operator = (const ProtoBase & rhs)
+            ProtoMessageField & operator = (ProtoMessageField && rhs) noexcept
             {
                 if (this == &rhs)
                 {
                     return *this;
                 }
 
-                mIndex = rhs.mIndex;
-                mHasValue = rhs.mHasValue;
-                mRequired = rhs.mRequired;
+                ProtoBase::operator=(std::move(rhs));
+
+                mValue = std::move(rhs.mValue);
+                mArena = rhs.mArena;
 
                 return *this;
             }
 
         private:
-            unsigned int mIndex;
-            bool mHasValue;
-            bool mRequired;
-        };
-
-        class ProtoMessage : public ProtoBase
-        {
-        public:
-            virtual unsigned int key () const
+            // Returns an empty message. The current or spare value is cleared and returned when nothing else refers
+            // to it so its storage can be used again.
+            std::shared_ptr<MessageType> emptyValue ()
             {
-                return (this->index() << 3) | 0x02;
-            }
+                std::shared_ptr<MessageType> result;
+                if (mValue.use_count() == 1)
+                {
+                    result = std::move(mValue);
+                }
+                else if (mSpare != nullptr)
+                {
+                    result = std::move(mSpare);
+                }
 
-        protected:
-            ProtoMessage ()
-            {
-                this->setValue();
+                if (result == nullptr)
+                {
+                    result = makeShared<MessageType>(mArena, mArena);
+                    result->setIndex(this->index());
+                }
+                else
+                {
+                    result->clear();
+                }
+
+                return result;
             }
+
+            std::shared_ptr<MessageType> mValue;
+            std::shared_ptr<MessageType> mSpare;
+            Arena * mArena;
         };
 
+        // Holds a nested message that is only decoded the first time it is read. Until then the field keeps the
+        // encoded bytes, including the length, and writes them back out unchanged. Reading the value of a const
+        // field may decode it, so a lazy field must not be read from several threads at once.
         template <typename MessageType>
-        class ProtoMessageField : public ProtoBase
+        class ProtoLazyMessageField final : public ProtoBase
         {
         public:
-            explicit ProtoMessageField ()
+            explicit ProtoLazyMessageField ()
+            : mArena(nullptr), mPending(false), mAliased(false)
             {}
 
-            ProtoMessageField (const ProtoMessageField & src)
-            : ProtoBase(src), mValue(src.mValue)
+            ProtoLazyMessageField (const ProtoLazyMessageField & src)
+            : ProtoBase(src), mValue(src.mValue), mBytes(src.mBytes), mAlias(src.mAlias), mArena(src.mArena),
+              mPending(src.mPending), mAliased(src.mAliased)
+            {}
+
+            ProtoLazyMessageField (ProtoLazyMessageField && src) noexcept
+            : ProtoBase(std::move(src)), mValue(std::move(src.mValue)), mBytes(std::move(src.mBytes)), mAlias(src.mAlias),
+              mArena(src.mArena), mPending(src.mPending), mAliased(src.mAliased)
             {}
 
-            virtual const MessageType & value () const
+            void setArena (Arena * pArena)
+            {
+                mArena = pArena;
+            }
+
+            const MessageType & value () const
             {
+                if (mPending)
+                {
+                    std::shared_ptr<MessageType> newValue = makeShared<MessageType>(mArena, mArena);
+
+                    newValue->setIndex(this->index());
+
+                    ByteView bytes = pendingBytes();
+                    newValue->parse(bytes.data(), bytes.size());
+
+                    mValue = newValue;
+                    clearPending();
+                }
                 return *mValue;
             }
 
-            virtual void setValue (const MessageType & message)
+            void setValue (const MessageType & message)
+            {
+                std::shared_ptr<MessageType> newValue = makeShared<MessageType>(mArena, message);
+
+                newValue->setIndex(this->index());
+
+                mValue = newValue;
+                clearPending();
+            }
+
+            void setValue (MessageType && message)
             {
-                std::shared_ptr<MessageType> newValue(new MessageType(message));
+                std::shared_ptr<MessageType> newValue = makeShared<MessageType>(mArena, std::move(message));
 
                 newValue->setIndex(this->index());
 
                 mValue = newValue;
+                clearPending();
+            }
+
+            // Returns the value for changing in place, decoding or creating it if needed. A shared value is copied first,
+            // including the data of a message that shares its data.
+            MessageType & mutableValue ()
+            {
+                if (!hasValue())
+                {
+                    return createNewValue();
+                }
+                value();
+                if (mValue.use_count() > 1)
+                {
+                    mValue = makeShared<MessageType>(mArena, mValue->deepCopy());
+                }
+                return *mValue;
             }
 
-            virtual MessageType & createNewValue ()
+            MessageType & createNewValue ()
             {
-                std::shared_ptr<MessageType> newValue(new MessageType());
+                std::shared_ptr<MessageType> newValue = makeShared<MessageType>(mArena, mArena);
 
                 newValue->setIndex(this->index());
 
                 mValue = newValue;
+                clearPending();
 
                 return *mValue;
             }
 
             virtual unsigned int key () const
             {
-                return mValue->key();
+                return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
-                std::shared_ptr<MessageType> newValue(new MessageType());
+                size_t bytesParsed = pendingByteSize(pData, available);
 
-                newValue->setIndex(this->index());
+                mBytes.assign(pData, bytesParsed);
+                mAlias = ByteView();
+                mValue = nullptr;
+                mPending = true;
+                mAliased = false;
 
-                mValue = newValue;
+                return bytesParsed;
+            }
+
+            virtual size_t parseAliased (const char * pData, size_t available)
+            {
+                size_t bytesParsed = pendingByteSize(pData, available);
+
+                mBytes.clear();
+                mAlias = ByteView(pData, bytesParsed);
+                mValue = nullptr;
+                mPending = true;
+                mAliased = true;
 
-                return mValue->parse(pData);
+                return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
                 if (!this->hasValue())
                 {
-                    return "";
+                    return pData;
+                }
+                if (mPending)
+                {
+                    ByteView bytes = pendingBytes();
+
+                    pData = writeKeyTo(pData, pTag, tagSize);
+
+                    std::memcpy(pData, bytes.data(), bytes.size());
+
+                    return pData + bytes.size();
                 }
-                return mValue->serialize();
+                return mValue->writeTo(pData, pTag, tagSize);
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 if (!this->hasValue())
                 {
                     return 0;
                 }
-                return mValue->byteSize();
+                if (mPending)
+                {
+                    return keyByteSize(tagSize) + pendingBytes().size();
+                }
+                return mValue->byteSize(tagSize);
             }
 
-            virtual bool hasValue () const
+            bool hasValue () const
             {
-                return mValue != nullptr;
+                return mPending || mValue != nullptr;
             }
 
-            virtual void clearValue ()
+            void clearValue ()
             {
                 mValue = nullptr;
+                clearPending();
             }
 
             virtual bool valid () const
             {
                 if (hasValue())
                 {
-                    return mValue->valid();
-                }
-                else if (required())
-                {
-                    return false;
+                    return value().valid();
                 }
                 return true;
             }
 
-            ProtoMessageField & operator = (const ProtoMessageField & rhs)
+            ProtoLazyMessageField & operator = (const ProtoLazyMessageField & rhs)
             {
                 if (this == &rhs)
                 {
@@ -629,59 +2220,188 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 ProtoBase::operator=(rhs);
-                
+
                 mValue = rhs.mValue;
+                mBytes = rhs.mBytes;
+                mAlias = rhs.mAlias;
+                mArena = rhs.mArena;
+                mPending = rhs.mPending;
+                mAliased = rhs.mAliased;
+
+                return *this;
+            }
+
+            ProtoLazyMessageField & operator = (ProtoLazyMessageField && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(std::move(rhs));
+
+                mValue = std::move(rhs.mValue);
+                mBytes = std::move(rhs.mBytes);
+                mAlias = rhs.mAlias;
+                mArena = rhs.mArena;
+                mPending = rhs.mPending;
+                mAliased = rhs.mAliased;
 
                 return *this;
             }
 
         private:
-            std::shared_ptr<MessageType> mValue;
+            static size_t pendingByteSize (const char * pData, size_t available)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                size_t lengthBytesParsed = 0;
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Message length exceeds available data.");
+                }
+
+                return lengthBytesParsed + length;
+            }
+
+            ByteView pendingBytes () const
+            {
+                if (mAliased)
+                {
+                    return mAlias;
+                }
+                return ByteView(mBytes);
+            }
+
+            void clearPending () const
+            {
+                mBytes.clear();
+                mAlias = ByteView();
+                mPending = false;
+                mAliased = false;
+            }
+
+            mutable std::shared_ptr<MessageType> mValue;
+            mutable std::string mBytes;
+            mutable ByteView mAlias;
+            Arena * mArena;
+            mutable bool mPending;
+            mutable bool mAliased;
         };
 
+        // Messages are stored by value in one contiguous vector. As with std::vector, adding messages can
+        // invalidate references returned earlier, so call reserve first when references need to be kept.
+        // Clearing keeps the messages past the end so that adding or parsing messages later can clear and reuse
+        // them along with the storage they already hold.
         template <typename MessageType>
-        class ProtoMessageCollection : public ProtoBase
+        class ProtoMessageCollection final : public ProtoBase
         {
         public:
+            typedef typename std::vector<MessageType>::const_iterator const_iterator;
+
             explicit ProtoMessageCollection ()
+            : mSize(0), mArena(nullptr)
             {}
 
-            virtual const MessageType & value (size_t index) const
+            // Each message is copied with data of its own so that changing a copied message in place leaves the
+            // source alone.
+            ProtoMessageCollection (const ProtoMessageCollection<MessageType> & src)
+            : ProtoBase(src), mSize(0), mArena(src.mArena)
+            {
+                copyValues(src);
+            }
+
+            ProtoMessageCollection (ProtoMessageCollection<MessageType> && src) noexcept
+            : ProtoBase(std::move(src)), mCollection(std::move(src.mCollection)), mSize(src.mSize), mArena(src.mArena)
             {
-                return mCollection[index].value();
+                src.mSize = 0;
             }
 
-            virtual void setValue (size_t index, const MessageType & message)
+            void setArena (Arena * pArena)
             {
-                ProtoMessageField<MessageType> newValue;
+                mArena = pArena;
+            }
 
-                newValue.setIndex(this->index());
-                newValue.setValue(message);
-                
-                mCollection[index] = newValue;
+            const MessageType & value (size_t index) const
+            {
+                return mCollection[index];
+            }
+
+            void setValue (size_t index, const MessageType & message)
+            {
+                mCollection[index] = message;
+                mCollection[index].setIndex(this->index());
             }
 
-            virtual void addValue (const MessageType & message)
+            void addValue (const MessageType & message)
             {
-                ProtoMessageField<MessageType> newValue;
+                if (mSize < mCollection.size())
+                {
+                    mCollection[mSize] = message;
+                }
+                else
+                {
+                    mCollection.push_back(message);
+                }
+                mCollection[mSize].setIndex(this->index());
+                ++mSize;
+            }
+
+            void setValue (size_t index, MessageType && message)
+            {
+                mCollection[index] = std::move(message);
+                mCollection[index].setIndex(this->index());
+            }
 
-                newValue.setIndex(this->index());
-                newValue.setValue(message);
+            void addValue (MessageType && message)
+            {
+                if (mSize < mCollection.size())
+                {
+                    mCollection[mSize] = std::move(message);
+                }
+                else
+                {
+                    mCollection.push_back(std::move(message));
+                }
+                mCollection[mSize].setIndex(this->index());
+                ++mSize;
+            }
 
-                mCollection.push_back(newValue);
+            MessageType & mutableValue (size_t index)
+            {
+                return mCollection[index];
             }
 
-            virtual MessageType & addNewValue ()
+            MessageType & addNewValue ()
             {
-                ProtoMessageField<MessageType> newValue;
+                MessageType & result = nextValue();
+                ++mSize;
+
+                return result;
+            }
 
-                newValue.setIndex(this->index());
+            void reserve (size_t count)
+            {
+                mCollection.reserve(count);
+            }
 
-                MessageType & returnValue = newValue.createNewValue();
+            ArrayView<MessageType> values () const
+            {
+                return ArrayView<MessageType>(mCollection.data(), mSize);
+            }
 
-                mCollection.push_back(newValue);
+            const_iterator begin () const
+            {
+                return mCollection.begin();
+            }
 
-                return returnValue;
+            const_iterator end () const
+            {
+                return mCollection.begin() + mSize;
             }
 
             virtual unsigned int key () const
@@ -689,120 +2409,169 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
                     throw std::invalid_argument("pData cannot be null.");
                 }
 
-                ProtoMessageField<MessageType> newValue;
+                size_t bytesParsed = nextValue().parse(pData, available);
+                ++mSize;
+
+                return bytesParsed;
+            }
 
-                newValue.setIndex(this->index());
-                size_t bytesParsed = newValue.parse(pData);
+            virtual size_t parseAliased (const char * pData, size_t available)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
 
-                mCollection.push_back(newValue);
+                size_t bytesParsed = nextValue().parseAliased(pData, available);
+                ++mSize;
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                for (auto & message : mCollection)
+                for (auto & message : *this)
                 {
-                    result += message.serialize();
+                    pData = message.writeTo(pData, pTag, tagSize);
                 }
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                for (auto & message : mCollection)
+                for (auto & message : *this)
                 {
-                    result += message.byteSize();
+                    result += message.byteSize(tagSize);
                 }
 
                 return result;
             }
 
-            virtual size_t size () const
+            size_t size () const
             {
-                return mCollection.size();
+                return mSize;
             }
 
-            virtual bool hasValue () const
+            bool hasValue () const
             {
-                return !mCollection.empty();
+                return mSize != 0;
             }
 
-            virtual void clearValue ()
+            void clearValue ()
             {
-                mCollection.clear();
+                mSize = 0;
             }
 
             virtual bool valid () const
             {
-                if (!mCollection.empty())
+                for (auto & message: *this)
                 {
-                    for (auto & message: mCollection)
+                    if (!message.valid())
                     {
-                        if (!message.valid())
-                        {
-                            return false;
-                        }
+                        return false;
                     }
                 }
                 return true;
             }
 
+            ProtoMessageCollection<MessageType> & operator = (const ProtoMessageCollection<MessageType> & rhs)
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(rhs);
+
+                mArena = rhs.mArena;
+                copyValues(rhs);
+
+                return *this;
+            }
+
+            ProtoMessageCollection<MessageType> & operator = (ProtoMessageCollection<MessageType> && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(std::move(rhs));
+
+                mCollection = std::move(rhs.mCollection);
+                mSize = rhs.mSize;
+                mArena = rhs.mArena;
+                rhs.mSize = 0;
+
+                return *this;
+            }
+
         protected:
-            virtual const std::vector<ProtoMessageField<MessageType>> * collection () const
+            virtual const std::vector<MessageType> * collection () const
             {
                 return &mCollection;
             }
 
         private:
-            ProtoMessageCollection (const ProtoMessageCollection<MessageType> & src) = delete;
-            ProtoMessageCollection<MessageType> & operator = (const ProtoMessageCollection<MessageType> & rhs) = delete;
+            void copyValues (const ProtoMessageCollection<MessageType> & src)
+            {
+                mCollection.clear();
+                mCollection.reserve(src.mSize);
+                for (auto & message: src)
+                {
+                    mCollection.push_back(message.deepCopy());
+                }
+                mSize = src.mSize;
+            }
+
+            // Returns an empty message at the end, either a cleared one left from before or a new one.
+            MessageType & nextValue ()
+            {
+                if (mSize < mCollection.size())
+                {
+                    mCollection[mSize].clear();
+                }
+                else
+                {
+                    mCollection.emplace_back(mArena);
+                }
+                mCollection[mSize].setIndex(this->index());
+
+                return mCollection[mSize];
+            }
 
-            std::vector<ProtoMessageField<MessageType>> mCollection;
+            std::vector<MessageType> mCollection;
+            size_t mSize;
+            Arena * mArena;
         };
 
         template <typename NumericType>
         class ProtoNumericType : public ProtoBase
         {
         public:
-            virtual NumericType value () const
+            NumericType value () const
             {
                 return mValue;
             }
 
-            virtual void setValue (NumericType value)
+            void setValue (NumericType value)
             {
                 mValue = value;
-                ProtoBase::setValue();
             }
 
-            virtual void setValueToDefault ()
+            void clearValue ()
             {
-                mValue = mValueDefault;
-                ProtoBase::setValue();
-            }
-
-            virtual bool hasValue () const
-            {
-                return ProtoBase::hasValue();
-            }
-
-            virtual void clearValue ()
-            {
-                mValue = mValueInitial;
-                ProtoBase::clearValue();
+                mValue = NumericType();
             }
 
             virtual unsigned int key () const
@@ -811,12 +2580,17 @@ R"MuddledManaged(namespace MuddledManaged
             }
 
         protected:
-            ProtoNumericType (NumericType value, NumericType defaultValue)
-            : mValue(value), mValueInitial(value), mValueDefault(defaultValue)
+            ProtoNumericType ()
+            : mValue()
             {}
 
             ProtoNumericType (const ProtoNumericType<NumericType> & src)
-            : ProtoBase(src), mValue(src.mValue), mValueInitial(src.mValueInitial), mValueDefault(src.mValueDefault)
+            : ProtoBase(src), mValue(src.mValue)
+            {
+            }
+
+            ProtoNumericType (ProtoNumericType<NumericType> && src) noexcept
+            : ProtoBase(std::move(src)), mValue(src.mValue)
             {
             }
 
@@ -830,40 +2604,67 @@ R"MuddledManaged(namespace MuddledManaged
                 ProtoBase::operator=(rhs);
 
                 mValue = rhs.mValue;
-                mValueInitial = rhs.mValueInitial;
-                mValueDefault = rhs.mValueDefault;
+
+                return *this;
+            }
+
+            ProtoNumericType<NumericType> & operator = (ProtoNumericType<NumericType> && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(std::move(rhs));
+
+                mValue = rhs.mValue;
 
                 return *this;
             }
 
         private:
             NumericType mValue;
-            NumericType mValueInitial;
-            NumericType mValueDefault;
         };
 
         template <typename NumericType, typename ProtoType>
         class ProtoNumericTypeCollection : public ProtoBase
         {
         public:
-            virtual NumericType value (size_t index) const
+            // Values are stored contiguously. Booleans are stored as one byte each because std::vector<bool> is not contiguous.
+            typedef typename std::conditional<std::is_same<NumericType, bool>::value, std::uint8_t, NumericType>::type StorageType;
+
+            NumericType value (size_t index) const
+            {
+                return static_cast<NumericType>(mCollection[index]);
+            }
+
+            void setValue (size_t index, NumericType value)
             {
-                return mCollection[index].value();
+                mCollection[index] = static_cast<StorageType>(value);
+                mValuesByteSize.invalidate();
             }
 
-            virtual void setValue (size_t index, NumericType value)
+            void addValue (NumericType value)
             {
-                mCollection[index].setValue(value);
+                mCollection.push_back(static_cast<StorageType>(value));
+                mValuesByteSize.invalidate();
             }
 
-            virtual void addValue (NumericType value)
+            template <typename InputIterator>
+            void addValues (InputIterator first, InputIterator last)
             {
-                ProtoType newValue(mValueDefault);
+                mCollection.insert(mCollection.end(), first, last);
+                mValuesByteSize.invalidate();
+            }
 
-                newValue.setIndex(this->index());
-                newValue.setValue(value);
+            void reserve (size_t count)
+            {
+                mCollection.reserve(count);
+            }
 
-                mCollection.push_back(newValue);
+            ArrayView<StorageType> values () const
+            {
+                return ArrayView<StorageType>(mCollection.data(), mCollection.size());
             }
 
             virtual unsigned int key () const
@@ -871,19 +2672,53 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t size () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
+            {
+                size_t valuesSize = 0;
+                if (!mValuesByteSize.cached(&valuesSize))
+                {
+                    valuesSize = valuesByteSize();
+                }
+                if (valuesSize == 0)
+                {
+                    return pData;
+                }
+
+                pData = this->writeKeyTo(pData, pTag, tagSize);
+                pData = PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(valuesSize), pData);
+
+                return writeValuesTo(pData);
+            }
+
+            virtual size_t byteSize (unsigned int tagSize) const
+            {
+                size_t result = valuesByteSize();
+
+                mValuesByteSize.set(result);
+
+                if (result != 0)
+                {
+                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
+                    result += this->keyByteSize(tagSize);
+                }
+
+                return result;
+            }
+
+            size_t size () const
             {
                 return mCollection.size();
             }
 
-            virtual bool hasValue () const
+            bool hasValue () const
             {
                 return !mCollection.empty();
             }
 
-            virtual void clearValue ()
+            void clearValue ()
             {
                 mCollection.clear();
+                mValuesByteSize.invalidate();
             }
 
             virtual bool valid () const
@@ -891,30 +2726,76 @@ R"MuddledManaged(namespace MuddledManaged
                 return true;
             }
 
+            ProtoNumericTypeCollection<NumericType, ProtoType> & operator = (const ProtoNumericTypeCollection<NumericType, ProtoType> & rhs)
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(rhs);
+
+                mCollection = rhs.mCollection;
+                mValuesByteSize.invalidate();
+
+                return *this;
+            }
+
+            ProtoNumericTypeCollection<NumericType, ProtoType> & operator = (ProtoNumericTypeCollection<NumericType, ProtoType> && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(std::move(rhs));
+
+                mCollection = std::move(rhs.mCollection);
+                mValuesByteSize.invalidate();
+
+                return *this;
+            }
+
         protected:
-            ProtoNumericTypeCollection (NumericType defaultValue)
-            : mValueDefault(defaultValue)
+            ProtoNumericTypeCollection ()
+            {}
+
+            ProtoNumericTypeCollection (const ProtoNumericTypeCollection<NumericType, ProtoType> & src)
+            : ProtoBase(src), mCollection(src.mCollection)
+            {}
+
+            ProtoNumericTypeCollection (ProtoNumericTypeCollection<NumericType, ProtoType> && src) noexcept
+            : ProtoBase(std::move(src)), mCollection(std::move(src.mCollection))
             {}
 
-            virtual const std::vector<ProtoType> * collection () const
+            virtual const std::vector<StorageType> * collection () const
             {
                 return &mCollection;
             }
 
-        private:
-            ProtoNumericTypeCollection (const ProtoNumericTypeCollection<NumericType, ProtoType> & src) = delete;
-            ProtoNumericTypeCollection<NumericType, ProtoType> & operator = (const ProtoNumericTypeCollection<NumericType, ProtoType> & rhs) = delete;
+            StorageType * appendValues (size_t count)
+            {
+                size_t offset = mCollection.size();
+                mCollection.resize(offset + count);
+                mValuesByteSize.invalidate();
+
+                return mCollection.data() + offset;
+            }
+
+            virtual size_t valuesByteSize () const = 0;
 
-            std::vector<ProtoType> mCollection;
-            NumericType mValueDefault;
+            virtual char * writeValuesTo (char * pData) const = 0;
+
+        private:
+            std::vector<StorageType> mCollection;
+            CachedByteSize mValuesByteSize;
         };
 
         template <typename EnumType>
-        class ProtoEnum : public ProtoNumericType<EnumType>
+        class ProtoEnum final : public ProtoNumericType<EnumType>
         {
         public:
-            explicit ProtoEnum (EnumType defaultValue = static_cast<EnumType>(0))
-            : ProtoNumericType<EnumType>(static_cast<EnumType>(0), defaultValue)
+            explicit ProtoEnum ()
             {}
 
             ProtoEnum (const ProtoEnum<EnumType> & src)
@@ -934,7 +2815,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoEnum (ProtoEnum<EnumType> && src) noexcept
+            : ProtoNumericType<EnumType>(std::move(src))
+            {
+            }
+
+            ProtoEnum<EnumType> & operator = (ProtoEnum<EnumType> && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<EnumType>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -942,40 +2840,28 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::int64_t enumValue = PrimitiveEncoding::parseVariableInt64(pData, &bytesParsed);
+                std::int64_t enumValue = PrimitiveEncoding::parseVariableInt64(pData, available, &bytesParsed);
 
                 this->setValue(static_cast<EnumType>(enumValue));
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
                 std::int64_t enumValue = static_cast<std::int64_t>(this->value());
-                result += PrimitiveEncoding::serializeVariableInt64(enumValue);
+                pData = PrimitiveEncoding::serializeVariableInt64(enumValue, pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
 
                 std::int64_t enumValue = static_cast<std::int64_t>(this->value());
                 result += PrimitiveEncoding::sizeVariableInt64(enumValue);
@@ -985,14 +2871,13 @@ R"MuddledManaged(namespace MuddledManaged
         };
 
         template <typename EnumType>
-        class ProtoEnumCollection : public ProtoNumericTypeCollection<EnumType, ProtoEnum<EnumType>>
+        class ProtoEnumCollection final : public ProtoNumericTypeCollection<EnumType, ProtoEnum<EnumType>>
         {
         public:
-            explicit ProtoEnumCollection (EnumType defaultValue = static_cast<EnumType>(0))
-            : ProtoNumericTypeCollection<EnumType, ProtoEnum<EnumType>>(defaultValue)
+            explicit ProtoEnumCollection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1000,72 +2885,43 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::uint32_t remainingBytes = length;
-                while (remainingBytes)
+                if (length > available - lengthBytesParsed)
                 {
-                    size_t bytesParsed = 0;
-                    std::int64_t enumValue = PrimitiveEncoding::parseVariableInt64(pData, &bytesParsed);
-
-                    this->addValue(static_cast<EnumType>(enumValue));
-                    
-                    pData += bytesParsed;
-                    remainingBytes -= bytesParsed;
+                    throw ProtocolBufferException("Length exceeds available data.");
                 }
 
-                return lengthBytesParsed + length;
-            }
-
-            virtual std::string serialize () const
-            {
-                std::string result;
+                size_t valueCount = PrimitiveEncoding::countVariables(pData, length);
+                EnumType * pValues = this->appendValues(valueCount);
 
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableInt64(static_cast<std::int64_t>(protoValue.value()));
-                    }
-                }
-                if (!result.empty())
+                size_t bytesParsed = 0;
+                PrimitiveEncoding::parsePackedVariableEnum(pData, length, pValues, valueCount, &bytesParsed);
+                if (bytesParsed != length)
                 {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
+                    throw ProtocolBufferException("VarInt exceeds available data.");
                 }
 
-                return result;
+                return lengthBytesParsed + length;
             }
 
-            virtual size_t byteSize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::sizeVariableInt64(static_cast<std::int64_t>(protoValue.value()));
-                    }
-                }
-
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
+                return PrimitiveEncoding::sizePackedVariableEnum(this->collection()->data(), this->size());
+            }
 
-                return result;
+            virtual char * writeValuesTo (char * pData) const
+            {
+                return PrimitiveEncoding::serializePackedVariableEnum(this->collection()->data(), this->size(), pData);
             }
         };
 
-        class ProtoBool : public ProtoNumericType<bool>
+        class ProtoBool final : public ProtoNumericType<bool>
         {
         public:
-            explicit ProtoBool (bool defaultValue = false)
-            : ProtoNumericType<bool>(false, defaultValue)
+            explicit ProtoBool ()
             {}
 
             ProtoBool (const ProtoBool & src)
@@ -1085,7 +2941,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoBool (ProtoBool && src) noexcept
+            : ProtoNumericType<bool>(std::move(src))
+            {
+            }
+
+            ProtoBool & operator = (ProtoBool && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<bool>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1093,7 +2966,7 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::int32_t boolValue = PrimitiveEncoding::parseVariableInt32(pData, &bytesParsed);
+                std::int32_t boolValue = PrimitiveEncoding::parseVariableInt32(pData, available, &bytesParsed);
                 if (bytesParsed != 1)
                 {
                     throw ProtocolBufferException("Boolean VarInt length exceeded one byte.");
@@ -1115,32 +2988,20 @@ R"MuddledManaged(namespace MuddledManaged
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = PrimitiveEncoding::serializeVariableInt32(this->value() ? 1 : 0, pData);
 
-                result += PrimitiveEncoding::serializeVariableInt32(this->value() ? 1 : 0);
-                
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
 
                 result += 1;
                 
@@ -1148,14 +3009,13 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoBoolCollection : public ProtoNumericTypeCollection<bool, ProtoBool>
+        class ProtoBoolCollection final : public ProtoNumericTypeCollection<bool, ProtoBool>
         {
         public:
-            explicit ProtoBoolCollection (bool defaultValue = false)
-            : ProtoNumericTypeCollection<bool, ProtoBool>(defaultValue)
+            explicit ProtoBoolCollection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1163,13 +3023,18 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
                 for (unsigned int i = 0; i < length; ++i)
                 {
                     size_t bytesParsed = 0;
-                    std::int64_t boolValue = PrimitiveEncoding::parseVariableInt32(pData, &bytesParsed);
+                    std::int64_t boolValue = PrimitiveEncoding::parseVariableInt32(pData, length - i, &bytesParsed);
                     if (bytesParsed != 1)
                     {
                         throw ProtocolBufferException("Boolean VarInt length exceeded one byte.");
@@ -1194,54 +3059,22 @@ R"MuddledManaged(namespace MuddledManaged
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableInt32(protoValue.value() ? 1 : 0);
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return this->size();
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += 1;
-                    }
-                }
-
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-
-                return result;
+                return PrimitiveEncoding::serializePackedBool(this->collection()->data(), this->size(), pData);
             }
         };
 
-        class ProtoInt32 : public ProtoNumericType<std::int32_t>
+        class ProtoInt32 final : public ProtoNumericType<std::int32_t>
         {
         public:
-            explicit ProtoInt32 (std::int32_t defaultValue = 0)
-            : ProtoNumericType<std::int32_t>(0, defaultValue)
+            explicit ProtoInt32 ()
             {}
 
             ProtoInt32 (const ProtoInt32 & src)
@@ -1261,7 +3094,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoInt32 (ProtoInt32 && src) noexcept
+            : ProtoNumericType<std::int32_t>(std::move(src))
+            {
+            }
+
+            ProtoInt32 & operator = (ProtoInt32 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<std::int32_t>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1269,39 +3119,27 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::int32_t numericValue = PrimitiveEncoding::parseVariableInt32(pData, &bytesParsed);
+                std::int32_t numericValue = PrimitiveEncoding::parseVariableInt32(pData, available, &bytesParsed);
 
                 this->setValue(numericValue);
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableInt32(this->value());
+                pData = PrimitiveEncoding::serializeVariableInt32(this->value(), pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
 
                 result += PrimitiveEncoding::sizeVariableInt32(this->value());
 
@@ -1309,14 +3147,13 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoInt32Collection : public ProtoNumericTypeCollection<std::int32_t, ProtoInt32>
+        class ProtoInt32Collection final : public ProtoNumericTypeCollection<std::int32_t, ProtoInt32>
         {
         public:
-            explicit ProtoInt32Collection (std::int32_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int32_t, ProtoInt32>(defaultValue)
+            explicit ProtoInt32Collection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1324,72 +3161,43 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::uint32_t remainingBytes = length;
-                while (remainingBytes)
+                if (length > available - lengthBytesParsed)
                 {
-                    size_t bytesParsed = 0;
-                    std::int32_t numericValue = PrimitiveEncoding::parseVariableInt32(pData, &bytesParsed);
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
 
-                    this->addValue(numericValue);
+                size_t valueCount = PrimitiveEncoding::countVariables(pData, length);
+                std::int32_t * pValues = this->appendValues(valueCount);
 
-                    pData += bytesParsed;
-                    remainingBytes -= bytesParsed;
+                size_t bytesParsed = 0;
+                PrimitiveEncoding::parsePackedVariableInt32(pData, length, pValues, valueCount, &bytesParsed);
+                if (bytesParsed != length)
+                {
+                    throw ProtocolBufferException("VarInt exceeds available data.");
                 }
 
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableInt32(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return PrimitiveEncoding::sizePackedVariableInt32(this->collection()->data(), this->size());
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::sizeVariableInt32(protoValue.value());
-                    }
-                }
-
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return PrimitiveEncoding::serializePackedVariableInt32(this->collection()->data(), this->size(), pData);
             }
         };
 
-        class ProtoInt64 : public ProtoNumericType<std::int64_t>
+        class ProtoInt64 final : public ProtoNumericType<std::int64_t>
         {
         public:
-            explicit ProtoInt64 (std::int64_t defaultValue = 0)
-            : ProtoNumericType<std::int64_t>(0, defaultValue)
+            explicit ProtoInt64 ()
             {}
 
             ProtoInt64 (const ProtoInt64 & src)
@@ -1409,7 +3217,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoInt64 (ProtoInt64 && src) noexcept
+            : ProtoNumericType<std::int64_t>(std::move(src))
+            {
+            }
+
+            ProtoInt64 & operator = (ProtoInt64 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<std::int64_t>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1417,39 +3242,27 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::int64_t numericValue = PrimitiveEncoding::parseVariableInt64(pData, &bytesParsed);
+                std::int64_t numericValue = PrimitiveEncoding::parseVariableInt64(pData, available, &bytesParsed);
 
                 this->setValue(numericValue);
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableInt64(this->value());
+                pData = PrimitiveEncoding::serializeVariableInt64(this->value(), pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += PrimitiveEncoding::sizeVariableInt64(this->value());
                 
@@ -1457,14 +3270,13 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoInt64Collection : public ProtoNumericTypeCollection<std::int64_t, ProtoInt64>
+        class ProtoInt64Collection final : public ProtoNumericTypeCollection<std::int64_t, ProtoInt64>
         {
         public:
-            explicit ProtoInt64Collection (std::int64_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int64_t, ProtoInt64>(defaultValue)
+            explicit ProtoInt64Collection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1472,72 +3284,43 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::uint32_t remainingBytes = length;
-                while (remainingBytes)
-                {
-                    size_t bytesParsed = 0;
-                    std::int64_t numericValue = PrimitiveEncoding::parseVariableInt64(pData, &bytesParsed);
-
-                    this->addValue(numericValue);
-
-                    pData += bytesParsed;
-                    remainingBytes -= bytesParsed;
-                }
-
-                return lengthBytesParsed + length;
-            }
-
-            virtual std::string serialize () const
-            {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableInt64(protoValue.value());
-                    }
-                }
-                if (!result.empty())
+                if (length > available - lengthBytesParsed)
                 {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
+                    throw ProtocolBufferException("Length exceeds available data.");
                 }
 
-                return result;
-            }
-
-            virtual size_t byteSize () const
-            {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::sizeVariableInt64(protoValue.value());
-                    }
-                }
+                size_t valueCount = PrimitiveEncoding::countVariables(pData, length);
+                std::int64_t * pValues = this->appendValues(valueCount);
 
-                if (result != 0)
+                size_t bytesParsed = 0;
+                PrimitiveEncoding::parsePackedVariableInt64(pData, length, pValues, valueCount, &bytesParsed);
+                if (bytesParsed != length)
                 {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                    throw ProtocolBufferException("VarInt exceeds available data.");
                 }
-                
-                return result;
+
+                return lengthBytesParsed + length;
+            }
+
+        protected:
+            virtual size_t valuesByteSize () const
+            {
+                return PrimitiveEncoding::sizePackedVariableInt64(this->collection()->data(), this->size());
+            }
+
+            virtual char * writeValuesTo (char * pData) const
+            {
+                return PrimitiveEncoding::serializePackedVariableInt64(this->collection()->data(), this->size(), pData);
             }
         };
 
-        class ProtoUnsignedInt32 : public ProtoNumericType<std::uint32_t>
+        class ProtoUnsignedInt32 final : public ProtoNumericType<std::uint32_t>
         {
         public:
-            explicit ProtoUnsignedInt32 (std::uint32_t defaultValue = 0)
-            : ProtoNumericType<std::uint32_t>(0, defaultValue)
+            explicit ProtoUnsignedInt32 ()
             {}
 
             ProtoUnsignedInt32 (const ProtoUnsignedInt32 & src)
@@ -1557,7 +3340,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoUnsignedInt32 (ProtoUnsignedInt32 && src) noexcept
+            : ProtoNumericType<std::uint32_t>(std::move(src))
+            {
+            }
+
+            ProtoUnsignedInt32 & operator = (ProtoUnsignedInt32 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<std::uint32_t>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1565,39 +3365,27 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::uint32_t numericValue = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &bytesParsed);
+                std::uint32_t numericValue = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &bytesParsed);
 
                 this->setValue(numericValue);
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->value());
+                pData = PrimitiveEncoding::serializeVariableUnsignedInt32(this->value(), pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->value());
                 
@@ -1605,14 +3393,13 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoUnsignedInt32Collection : public ProtoNumericTypeCollection<std::uint32_t, ProtoUnsignedInt32>
+        class ProtoUnsignedInt32Collection final : public ProtoNumericTypeCollection<std::uint32_t, ProtoUnsignedInt32>
         {
         public:
-            explicit ProtoUnsignedInt32Collection (std::uint32_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::uint32_t, ProtoUnsignedInt32>(defaultValue)
+            explicit ProtoUnsignedInt32Collection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1620,72 +3407,43 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::uint32_t remainingBytes = length;
-                while (remainingBytes)
+                if (length > available - lengthBytesParsed)
                 {
-                    size_t bytesParsed = 0;
-                    std::uint32_t numericValue = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &bytesParsed);
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
 
-                    this->addValue(numericValue);
+                size_t valueCount = PrimitiveEncoding::countVariables(pData, length);
+                std::uint32_t * pValues = this->appendValues(valueCount);
 
-                    pData += bytesParsed;
-                    remainingBytes -= bytesParsed;
+                size_t bytesParsed = 0;
+                PrimitiveEncoding::parsePackedVariableUnsignedInt32(pData, length, pValues, valueCount, &bytesParsed);
+                if (bytesParsed != length)
+                {
+                    throw ProtocolBufferException("VarInt exceeds available data.");
                 }
 
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableUnsignedInt32(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return PrimitiveEncoding::sizePackedVariableUnsignedInt32(this->collection()->data(), this->size());
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::sizeVariableUnsignedInt32(protoValue.value());
-                    }
-                }
-
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return PrimitiveEncoding::serializePackedVariableUnsignedInt32(this->collection()->data(), this->size(), pData);
             }
         };
 
-        class ProtoUnsignedInt64 : public ProtoNumericType<std::uint64_t>
+        class ProtoUnsignedInt64 final : public ProtoNumericType<std::uint64_t>
         {
         public:
-            explicit ProtoUnsignedInt64 (std::uint64_t defaultValue = 0)
-            : ProtoNumericType<std::uint64_t>(0, defaultValue)
+            explicit ProtoUnsignedInt64 ()
             {}
 
             ProtoUnsignedInt64 (const ProtoUnsignedInt64 & src)
@@ -1705,7 +3463,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoUnsignedInt64 (ProtoUnsignedInt64 && src) noexcept
+            : ProtoNumericType<std::uint64_t>(std::move(src))
+            {
+            }
+
+            ProtoUnsignedInt64 & operator = (ProtoUnsignedInt64 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<std::uint64_t>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1713,39 +3488,27 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::uint64_t numericValue = PrimitiveEncoding::parseVariableUnsignedInt64(pData, &bytesParsed);
+                std::uint64_t numericValue = PrimitiveEncoding::parseVariableUnsignedInt64(pData, available, &bytesParsed);
 
                 this->setValue(numericValue);
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableUnsignedInt64(this->value());
+                pData = PrimitiveEncoding::serializeVariableUnsignedInt64(this->value(), pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += PrimitiveEncoding::sizeVariableUnsignedInt64(this->value());
                 
@@ -1753,14 +3516,13 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoUnsignedInt64Collection : public ProtoNumericTypeCollection<std::uint64_t, ProtoUnsignedInt64>
+        class ProtoUnsignedInt64Collection final : public ProtoNumericTypeCollection<std::uint64_t, ProtoUnsignedInt64>
         {
         public:
-            explicit ProtoUnsignedInt64Collection (std::uint64_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::uint64_t, ProtoUnsignedInt64>(defaultValue)
+            explicit ProtoUnsignedInt64Collection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1768,72 +3530,43 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::uint32_t remainingBytes = length;
-                while (remainingBytes)
+                if (length > available - lengthBytesParsed)
                 {
-                    size_t bytesParsed = 0;
-                    std::uint64_t numericValue = PrimitiveEncoding::parseVariableUnsignedInt64(pData, &bytesParsed);
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
 
-                    this->addValue(numericValue);
+                size_t valueCount = PrimitiveEncoding::countVariables(pData, length);
+                std::uint64_t * pValues = this->appendValues(valueCount);
 
-                    pData += bytesParsed;
-                    remainingBytes -= bytesParsed;
+                size_t bytesParsed = 0;
+                PrimitiveEncoding::parsePackedVariableUnsignedInt64(pData, length, pValues, valueCount, &bytesParsed);
+                if (bytesParsed != length)
+                {
+                    throw ProtocolBufferException("VarInt exceeds available data.");
                 }
 
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableUnsignedInt64(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return PrimitiveEncoding::sizePackedVariableUnsignedInt64(this->collection()->data(), this->size());
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::sizeVariableUnsignedInt64(protoValue.value());
-                    }
-                }
-
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return PrimitiveEncoding::serializePackedVariableUnsignedInt64(this->collection()->data(), this->size(), pData);
             }
         };
 
-        class ProtoSignedInt32 : public ProtoNumericType<std::int32_t>
+        class ProtoSignedInt32 final : public ProtoNumericType<std::int32_t>
         {
         public:
-            explicit ProtoSignedInt32 (std::int32_t defaultValue = 0)
-            : ProtoNumericType<std::int32_t>(0, defaultValue)
+            explicit ProtoSignedInt32 ()
             {}
 
             ProtoSignedInt32 (const ProtoSignedInt32 & src)
@@ -1853,7 +3586,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoSignedInt32 (ProtoSignedInt32 && src) noexcept
+            : ProtoNumericType<std::int32_t>(std::move(src))
+            {
+            }
+
+            ProtoSignedInt32 & operator = (ProtoSignedInt32 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<std::int32_t>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1861,39 +3611,27 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::int32_t numericValue = PrimitiveEncoding::parseVariableSignedInt32(pData, &bytesParsed);
+                std::int32_t numericValue = PrimitiveEncoding::parseVariableSignedInt32(pData, available, &bytesParsed);
 
                 this->setValue(numericValue);
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableSignedInt32(this->value());
+                pData = PrimitiveEncoding::serializeVariableSignedInt32(this->value(), pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += PrimitiveEncoding::sizeVariableSignedInt32(this->value());
                 
@@ -1901,14 +3639,13 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoSignedInt32Collection : public ProtoNumericTypeCollection<std::int32_t, ProtoSignedInt32>
+        class ProtoSignedInt32Collection final : public ProtoNumericTypeCollection<std::int32_t, ProtoSignedInt32>
         {
         public:
-            explicit ProtoSignedInt32Collection (std::int32_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int32_t, ProtoSignedInt32>(defaultValue)
+            explicit ProtoSignedInt32Collection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -1916,72 +3653,43 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::uint32_t remainingBytes = length;
-                while (remainingBytes)
+                if (length > available - lengthBytesParsed)
                 {
-                    size_t bytesParsed = 0;
-                    std::int32_t numericValue = PrimitiveEncoding::parseVariableSignedInt32(pData, &bytesParsed);
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
 
-                    this->addValue(numericValue);
+                size_t valueCount = PrimitiveEncoding::countVariables(pData, length);
+                std::int32_t * pValues = this->appendValues(valueCount);
 
-                    pData += bytesParsed;
-                    remainingBytes -= bytesParsed;
+                size_t bytesParsed = 0;
+                PrimitiveEncoding::parsePackedVariableSignedInt32(pData, length, pValues, valueCount, &bytesParsed);
+                if (bytesParsed != length)
+                {
+                    throw ProtocolBufferException("VarInt exceeds available data.");
                 }
 
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableSignedInt32(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return PrimitiveEncoding::sizePackedVariableSignedInt32(this->collection()->data(), this->size());
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::sizeVariableSignedInt32(protoValue.value());
-                    }
-                }
-
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return PrimitiveEncoding::serializePackedVariableSignedInt32(this->collection()->data(), this->size(), pData);
             }
         };
 
-        class ProtoSignedInt64 : public ProtoNumericType<std::int64_t>
+        class ProtoSignedInt64 final : public ProtoNumericType<std::int64_t>
         {
         public:
-            explicit ProtoSignedInt64 (std::int64_t defaultValue = 0)
-            : ProtoNumericType<std::int64_t>(0, defaultValue)
+            explicit ProtoSignedInt64 ()
             {}
 
             ProtoSignedInt64 (const ProtoSignedInt64 & src)
@@ -2001,7 +3709,24 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoSignedInt64 (ProtoSignedInt64 && src) noexcept
+            : ProtoNumericType<std::int64_t>(std::move(src))
+            {
+            }
+
+            ProtoSignedInt64 & operator = (ProtoSignedInt64 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<std::int64_t>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2009,39 +3734,27 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t bytesParsed = 0;
-                std::int64_t numericValue = PrimitiveEncoding::parseVariableSignedInt64(pData, &bytesParsed);
+                std::int64_t numericValue = PrimitiveEncoding::parseVariableSignedInt64(pData, available, &bytesParsed);
 
                 this->setValue(numericValue);
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableSignedInt64(this->value());
+                pData = PrimitiveEncoding::serializeVariableSignedInt64(this->value(), pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += PrimitiveEncoding::sizeVariableSignedInt64(this->value());
                 
@@ -2049,14 +3762,13 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoSignedInt64Collection : public ProtoNumericTypeCollection<std::int64_t, ProtoSignedInt64>
+        class ProtoSignedInt64Collection final : public ProtoNumericTypeCollection<std::int64_t, ProtoSignedInt64>
         {
         public:
-            explicit ProtoSignedInt64Collection (std::int64_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int64_t, ProtoSignedInt64>(defaultValue)
+            explicit ProtoSignedInt64Collection ()
             {}
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2064,72 +3776,43 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::uint32_t remainingBytes = length;
-                while (remainingBytes)
+                if (length > available - lengthBytesParsed)
                 {
-                    size_t bytesParsed = 0;
-                    std::int64_t numericValue = PrimitiveEncoding::parseVariableSignedInt64(pData, &bytesParsed);
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
 
-                    this->addValue(numericValue);
+                size_t valueCount = PrimitiveEncoding::countVariables(pData, length);
+                std::int64_t * pValues = this->appendValues(valueCount);
 
-                    pData += bytesParsed;
-                    remainingBytes -= bytesParsed;
+                size_t bytesParsed = 0;
+                PrimitiveEncoding::parsePackedVariableSignedInt64(pData, length, pValues, valueCount, &bytesParsed);
+                if (bytesParsed != length)
+                {
+                    throw ProtocolBufferException("VarInt exceeds available data.");
                 }
 
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeVariableSignedInt64(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return PrimitiveEncoding::sizePackedVariableSignedInt64(this->collection()->data(), this->size());
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::sizeVariableSignedInt64(protoValue.value());
-                    }
-                }
-
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return PrimitiveEncoding::serializePackedVariableSignedInt64(this->collection()->data(), this->size(), pData);
             }
         };
 
         class ProtoFixedInt32 : public ProtoNumericType<std::int32_t>
         {
         public:
-            explicit ProtoFixedInt32 (std::int32_t defaultValue = 0)
-            : ProtoNumericType<std::int32_t>(0, defaultValue)
+            explicit ProtoFixedInt32 ()
             {}
 
             ProtoFixedInt32 (const ProtoFixedInt32 & src)
@@ -2149,51 +3832,56 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
-            virtual unsigned int key () const
+            ProtoFixedInt32 (ProtoFixedInt32 && src) noexcept
+            : ProtoNumericType<std::int32_t>(std::move(src))
             {
-                return (this->index() << 3) | 0x05;
             }
 
-            virtual size_t parse (const char * pData)
+            ProtoFixedInt32 & operator = (ProtoFixedInt32 && rhs) noexcept
             {
-                if (pData == nullptr)
+                if (this == &rhs)
                 {
-                    throw std::invalid_argument("pData cannot be null.");
+                    return *this;
                 }
 
-                std::int32_t numericValue = PrimitiveEncoding::parseFixedInt32(pData);
-
-                this->setValue(numericValue);
+                ProtoNumericType<std::int32_t>::operator=(std::move(rhs));
 
-                return 4;
+                return *this;
             }
 
-            virtual std::string serialize () const
+            virtual unsigned int key () const
             {
-                std::string result;
+                return (this->index() << 3) | 0x05;
+            }
 
-                if (!this->hasValue())
+            virtual size_t parse (const char * pData, size_t available)
+            {
+                if (pData == nullptr)
                 {
-                    return result;
+                    throw std::invalid_argument("pData cannot be null.");
                 }
 
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                std::int32_t numericValue = PrimitiveEncoding::parseFixedInt32(pData, available);
+
+                this->setValue(numericValue);
+
+                return 4;
+            }
 
-                result += PrimitiveEncoding::serializeFixedInt32(this->value());
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
+            {
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                return result;
+                pData = PrimitiveEncoding::serializeFixedInt32(this->value(), pData);
+
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += 4;
                 
@@ -2201,11 +3889,10 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoFixedInt32Collection : public ProtoNumericTypeCollection<std::int32_t, ProtoFixedInt32>
+        class ProtoFixedInt32Collection final : public ProtoNumericTypeCollection<std::int32_t, ProtoFixedInt32>
         {
         public:
-            explicit ProtoFixedInt32Collection (std::int32_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int32_t, ProtoFixedInt32>(defaultValue)
+            explicit ProtoFixedInt32Collection ()
             {}
 
             virtual unsigned int key () const
@@ -2213,7 +3900,7 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2221,10 +3908,17 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
                 std::uint32_t itemCount = length / 4;
+                this->reserve(this->size() + itemCount);
+
                 for (unsigned int i = 0; i < itemCount; ++i)
                 {
                     std::int32_t numericValue = PrimitiveEncoding::parseFixedInt32(pData);
@@ -2237,54 +3931,27 @@ R"MuddledManaged(namespace MuddledManaged
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeFixedInt32(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return this->size() * 4;
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
+                for (auto value : *this->collection())
                 {
-                    if (protoValue.hasValue())
-                    {
-                        result += 4;
-                    }
+                    pData = PrimitiveEncoding::serializeFixedInt32(value, pData);
                 }
 
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return pData;
             }
         };
 
         class ProtoFixedInt64 : public ProtoNumericType<std::int64_t>
         {
         public:
-            explicit ProtoFixedInt64 (std::int64_t defaultValue = 0)
-            : ProtoNumericType<std::int64_t>(0, defaultValue)
+            explicit ProtoFixedInt64 ()
             {}
 
             ProtoFixedInt64 (const ProtoFixedInt64 & src)
@@ -2304,51 +3971,56 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
+            ProtoFixedInt64 (ProtoFixedInt64 && src) noexcept
+            : ProtoNumericType<std::int64_t>(std::move(src))
+            {
+            }
+
+            ProtoFixedInt64 & operator = (ProtoFixedInt64 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<std::int64_t>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
             virtual unsigned int key () const
             {
                 return (this->index() << 3) | 0x01;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
                     throw std::invalid_argument("pData cannot be null.");
                 }
 
-                std::int64_t numericValue = PrimitiveEncoding::parseFixedInt64(pData);
+                std::int64_t numericValue = PrimitiveEncoding::parseFixedInt64(pData, available);
 
                 this->setValue(numericValue);
 
                 return 8;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = PrimitiveEncoding::serializeFixedInt64(this->value(), pData);
 
-                result += PrimitiveEncoding::serializeFixedInt64(this->value());
-
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += 8;
                 
@@ -2356,11 +4028,10 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoFixedInt64Collection : public ProtoNumericTypeCollection<std::int64_t, ProtoFixedInt64>
+        class ProtoFixedInt64Collection final : public ProtoNumericTypeCollection<std::int64_t, ProtoFixedInt64>
         {
         public:
-            explicit ProtoFixedInt64Collection (std::int64_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int64_t, ProtoFixedInt64>(defaultValue)
+            explicit ProtoFixedInt64Collection ()
             {}
 
             virtual unsigned int key () const
@@ -2368,7 +4039,7 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2376,10 +4047,17 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
                 std::uint32_t itemCount = length / 8;
+                this->reserve(this->size() + itemCount);
+
                 for (unsigned int i = 0; i < itemCount; ++i)
                 {
                     std::int64_t numericValue = PrimitiveEncoding::parseFixedInt64(pData);
@@ -2392,54 +4070,27 @@ R"MuddledManaged(namespace MuddledManaged
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeFixedInt64(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return this->size() * 8;
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
+                for (auto value : *this->collection())
                 {
-                    if (protoValue.hasValue())
-                    {
-                        result += 8;
-                    }
+                    pData = PrimitiveEncoding::serializeFixedInt64(value, pData);
                 }
 
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return pData;
             }
         };
 
-        class ProtoFixedSignedInt32 : public ProtoFixedInt32
+        class ProtoFixedSignedInt32 final : public ProtoFixedInt32
         {
         public:
-            explicit ProtoFixedSignedInt32 (std::int32_t defaultValue = 0)
-            : ProtoFixedInt32(defaultValue)
+            explicit ProtoFixedSignedInt32 ()
             {}
 
             ProtoFixedSignedInt32 (const ProtoFixedSignedInt32 & src)
@@ -2458,13 +4109,29 @@ R"MuddledManaged(namespace MuddledManaged
 
                 return *this;
             }
+
+            ProtoFixedSignedInt32 (ProtoFixedSignedInt32 && src) noexcept
+            : ProtoFixedInt32(std::move(src))
+            {
+            }
+
+            ProtoFixedSignedInt32 & operator = (ProtoFixedSignedInt32 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoFixedInt32::operator=(std::move(rhs));
+
+                return *this;
+            }
         };
 
-        class ProtoFixedSignedInt32Collection : public ProtoNumericTypeCollection<std::int32_t, ProtoFixedSignedInt32>
+        class ProtoFixedSignedInt32Collection final : public ProtoNumericTypeCollection<std::int32_t, ProtoFixedSignedInt32>
         {
         public:
-            explicit ProtoFixedSignedInt32Collection (std::int32_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int32_t, ProtoFixedSignedInt32>(defaultValue)
+            explicit ProtoFixedSignedInt32Collection ()
             {}
 
             virtual unsigned int key () const
@@ -2472,7 +4139,7 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2480,10 +4147,17 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
                 std::uint32_t itemCount = length / 4;
+                this->reserve(this->size() + itemCount);
+
                 for (unsigned int i = 0; i < itemCount; ++i)
                 {
                     std::int32_t numericValue = PrimitiveEncoding::parseFixedSignedInt32(pData);
@@ -2496,54 +4170,27 @@ R"MuddledManaged(namespace MuddledManaged
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeFixedSignedInt32(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                    PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                    result;
-                }
-
-                return result;
+                return this->size() * 4;
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
+                for (auto value : *this->collection())
                 {
-                    if (protoValue.hasValue())
-                    {
-                        result += 4;
-                    }
+                    pData = PrimitiveEncoding::serializeFixedSignedInt32(value, pData);
                 }
 
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return pData;
             }
         };
 
-        class ProtoFixedSignedInt64 : public ProtoFixedInt64
+        class ProtoFixedSignedInt64 final : public ProtoFixedInt64
         {
         public:
-            explicit ProtoFixedSignedInt64 (std::int64_t defaultValue = 0)
-            : ProtoFixedInt64(defaultValue)
+            explicit ProtoFixedSignedInt64 ()
             {}
 
             ProtoFixedSignedInt64 (const ProtoFixedSignedInt64 & src)
@@ -2562,13 +4209,29 @@ R"MuddledManaged(namespace MuddledManaged
 
                 return *this;
             }
+
+            ProtoFixedSignedInt64 (ProtoFixedSignedInt64 && src) noexcept
+            : ProtoFixedInt64(std::move(src))
+            {
+            }
+
+            ProtoFixedSignedInt64 & operator = (ProtoFixedSignedInt64 && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoFixedInt64::operator=(std::move(rhs));
+
+                return *this;
+            }
         };
 
-        class ProtoFixedSignedInt64Collection : public ProtoNumericTypeCollection<std::int64_t, ProtoFixedSignedInt64>
+        class ProtoFixedSignedInt64Collection final : public ProtoNumericTypeCollection<std::int64_t, ProtoFixedSignedInt64>
         {
         public:
-            explicit ProtoFixedSignedInt64Collection (std::int64_t defaultValue = 0)
-            : ProtoNumericTypeCollection<std::int64_t, ProtoFixedSignedInt64>(defaultValue)
+            explicit ProtoFixedSignedInt64Collection ()
             {}
 
             virtual unsigned int key () const
@@ -2576,7 +4239,7 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2584,10 +4247,17 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
                 std::uint32_t itemCount = length / 8;
+                this->reserve(this->size() + itemCount);
+
                 for (unsigned int i = 0; i < itemCount; ++i)
                 {
                     std::int64_t numericValue = PrimitiveEncoding::parseFixedSignedInt64(pData);
@@ -2600,54 +4270,27 @@ R"MuddledManaged(namespace MuddledManaged
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeFixedSignedInt64(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                    PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                    result;
-                }
-
-                return result;
+                return this->size() * 8;
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
+                for (auto value : *this->collection())
                 {
-                    if (protoValue.hasValue())
-                    {
-                        result += 8;
-                    }
+                    pData = PrimitiveEncoding::serializeFixedSignedInt64(value, pData);
                 }
 
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return pData;
             }
         };
 
-        class ProtoFloat : public ProtoNumericType<float>
+        class ProtoFloat final : public ProtoNumericType<float>
         {
         public:
-            explicit ProtoFloat (float defaultValue = 0)
-            : ProtoNumericType<float>(0, defaultValue)
+            explicit ProtoFloat ()
             {}
 
             ProtoFloat (const ProtoFloat & src)
@@ -2667,51 +4310,56 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
+            ProtoFloat (ProtoFloat && src) noexcept
+            : ProtoNumericType<float>(std::move(src))
+            {
+            }
+
+            ProtoFloat & operator = (ProtoFloat && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<float>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
             virtual unsigned int key () const
             {
                 return (this->index() << 3) | 0x05;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
                     throw std::invalid_argument("pData cannot be null.");
                 }
 
-                float numericValue = PrimitiveEncoding::parseFloat(pData);
+                float numericValue = PrimitiveEncoding::parseFloat(pData, available);
 
                 this->setValue(numericValue);
 
                 return 4;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeFloat(this->value());
+                pData = PrimitiveEncoding::serializeFloat(this->value(), pData);
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += 4;
                 
@@ -2719,11 +4367,10 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoFloatCollection : public ProtoNumericTypeCollection<float, ProtoFloat>
+        class ProtoFloatCollection final : public ProtoNumericTypeCollection<float, ProtoFloat>
         {
         public:
-            explicit ProtoFloatCollection (float defaultValue = 0)
-            : ProtoNumericTypeCollection<float, ProtoFloat>(defaultValue)
+            explicit ProtoFloatCollection ()
             {}
 
             virtual unsigned int key () const
@@ -2731,7 +4378,7 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2739,10 +4386,17 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
                 std::uint32_t itemCount = length / 4;
+                this->reserve(this->size() + itemCount);
+
                 for (unsigned int i = 0; i < itemCount; ++i)
                 {
                     float numericValue = PrimitiveEncoding::parseFloat(pData);
@@ -2755,54 +4409,27 @@ R"MuddledManaged(namespace MuddledManaged
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeFloat(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return this->size() * 4;
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
+                for (auto value : *this->collection())
                 {
-                    if (protoValue.hasValue())
-                    {
-                        result += 4;
-                    }
+                    pData = PrimitiveEncoding::serializeFloat(value, pData);
                 }
 
-                if (result != 0)
-                {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
-                }
-                
-                return result;
+                return pData;
             }
         };
 
-        class ProtoDouble : public ProtoNumericType<double>
+        class ProtoDouble final : public ProtoNumericType<double>
         {
         public:
-            explicit ProtoDouble (double defaultValue = 0)
-            : ProtoNumericType<double>(0, defaultValue)
+            explicit ProtoDouble ()
             {}
 
             ProtoDouble (const ProtoDouble & src)
@@ -2822,51 +4449,56 @@ R"MuddledManaged(namespace MuddledManaged
                 return *this;
             }
 
+            ProtoDouble (ProtoDouble && src) noexcept
+            : ProtoNumericType<double>(std::move(src))
+            {
+            }
+
+            ProtoDouble & operator = (ProtoDouble && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoNumericType<double>::operator=(std::move(rhs));
+
+                return *this;
+            }
+
             virtual unsigned int key () const
             {
                 return (this->index() << 3) | 0x01;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
                     throw std::invalid_argument("pData cannot be null.");
                 }
 
-                double numericValue = PrimitiveEncoding::parseDouble(pData);
+                double numericValue = PrimitiveEncoding::parseDouble(pData, available);
 
                 this->setValue(numericValue);
 
                 return 8;
             }
 
-            virtual std::string serialize () const
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
             {
-                std::string result;
-
-                if (!this->hasValue())
-                {
-                    return result;
-                }
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+                pData = PrimitiveEncoding::serializeDouble(this->value(), pData);
 
-                result += PrimitiveEncoding::serializeDouble(this->value());
-
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
                 
                 result += 8;
                 
@@ -2874,11 +4506,10 @@ R"MuddledManaged(namespace MuddledManaged
             }
         };
 
-        class ProtoDoubleCollection : public ProtoNumericTypeCollection<double, ProtoDouble>
+        class ProtoDoubleCollection final : public ProtoNumericTypeCollection<double, ProtoDouble>
         {
         public:
-            explicit ProtoDoubleCollection (double defaultValue = 0)
-            : ProtoNumericTypeCollection<double, ProtoDouble>(defaultValue)
+            explicit ProtoDoubleCollection ()
             {}
 
             virtual unsigned int key () const
@@ -2886,7 +4517,7 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2894,10 +4525,17 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Length exceeds available data.");
+                }
+
                 std::uint32_t itemCount = length / 8;
+                this->reserve(this->size() + itemCount);
+
                 for (unsigned int i = 0; i < itemCount; ++i)
                 {
                     double numericValue = PrimitiveEncoding::parseDouble(pData);
@@ -2910,78 +4548,70 @@ R"MuddledManaged(namespace MuddledManaged
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+        protected:
+            virtual size_t valuesByteSize () const
             {
-                std::string result;
-
-                for (auto & protoValue: *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += PrimitiveEncoding::serializeDouble(protoValue.value());
-                    }
-                }
-                if (!result.empty())
-                {
-                    result = PrimitiveEncoding::serializeVariableUnsignedInt32(this->key()) +
-                        PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(result.length())) +
-                        result;
-                }
-
-                return result;
+                return this->size() * 8;
             }
 
-            virtual size_t byteSize () const
+            virtual char * writeValuesTo (char * pData) const
             {
-                size_t result = 0;
-
-                for (auto & protoValue : *this->collection())
-                {
-                    if (protoValue.hasValue())
-                    {
-                        result += 8;
-                    }
-                }
-
-                if (result != 0)
+                for (auto value : *this->collection())
                 {
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                    result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                    pData = PrimitiveEncoding::serializeDouble(value, pData);
                 }
-                
-                return result;
+
+                return pData;
             }
         };
 
         class ProtoStringType : public ProtoBase
         {
         public:
-            virtual const std::string & value () const
+            // An aliased value is copied into the string the first time it is asked for. This is safe to call from
+            // several threads at once; view reads an aliased value without copying it.
+            const std::string & value () const
             {
+                if (mAliasState.load(std::memory_order_acquire) != owned)
+                {
+                    copyAlias();
+                }
                 return mValue;
             }
 
-            virtual void setValue (const std::string & value)
+            ByteView view () const
+            {
+                if (mAliasState.load(std::memory_order_acquire) != owned)
+                {
+                    return mAlias;
+                }
+                return ByteView(mValue);
+            }
+
+            void setValue (const std::string & value)
             {
                 mValue = value;
-                ProtoBase::setValue();
+                mAliasState.store(owned, std::memory_order_relaxed);
             }
 
-            virtual void setValueToDefault ()
+            void setValue (std::string && value)
             {
-                mValue = mValueDefault;
-                ProtoBase::setValue();
+                mValue = std::move(value);
+                mAliasState.store(owned, std::memory_order_relaxed);
             }
 
-            virtual bool hasValue () const
+            // Returns the value for changing in place. The message sets the default first when the field is not present.
+            std::string & mutableValue ()
             {
-                return ProtoBase::hasValue();
+                value();
+
+                return mValue;
             }
 
-            virtual void clearValue ()
+            void clearValue ()
             {
-                mValue = mValueInitial;
-                ProtoBase::clearValue();
+                mValue.clear();
+                mAliasState.store(owned, std::memory_order_relaxed);
             }
 
             virtual unsigned int key () const
@@ -2989,7 +4619,7 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
                 if (pData == nullptr)
                 {
@@ -2997,61 +4627,64 @@ R"MuddledManaged(namespace MuddledManaged
                 }
 
                 size_t lengthBytesParsed = 0;
-                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, &lengthBytesParsed);
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
                 pData += lengthBytesParsed;
 
-                std::string stringValue;
-                for (unsigned int i = 0; i < length; ++i)
+                if (length > available - lengthBytesParsed)
                 {
-                    stringValue += *pData;
-                    ++pData;
+                    throw ProtocolBufferException("Length exceeds available data.");
                 }
-                this->setValue(stringValue);
+
+                // Assigning in place keeps the capacity of a value that is parsed again.
+                mValue.assign(pData, length);
+                mAliasState.store(owned, std::memory_order_relaxed);
 
                 return lengthBytesParsed + length;
             }
 
-            virtual std::string serialize () const
+            virtual size_t parseAliased (const char * pData, size_t available)
             {
-                std::string result;
+                size_t bytesParsed = 0;
+                mAlias = PrimitiveEncoding::parseBytesView(pData, available, &bytesParsed);
+                mAliasState.store(aliased, std::memory_order_relaxed);
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
+                return bytesParsed;
+            }
 
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(this->key());
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
+            {
+                pData = this->writeKeyTo(pData, pTag, tagSize);
 
-                result += PrimitiveEncoding::serializeVariableUnsignedInt32(static_cast<std::uint32_t>(mValue.size()));
+                pData = PrimitiveEncoding::serializeBytes(view(), pData);
 
-                result += mValue;
-                
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                if (!this->hasValue())
-                {
-                    return result;
-                }
-
-                result += mValue.size();
+                result += view().size();
                 result += PrimitiveEncoding::sizeVariableUnsignedInt32(static_cast<std::uint32_t>(result));
-                result += PrimitiveEncoding::sizeVariableUnsignedInt32(this->key());
+                result += this->keyByteSize(tagSize);
 
                 return result;
             }
 
         protected:
-            ProtoStringType (const std::string & value, const std::string & defaultValue)
-            : mValue(value), mValueInitial(value), mValueDefault(defaultValue)
+            ProtoStringType ()
+            : mAliasState(owned)
             {}
 
             ProtoStringType (const ProtoStringType & src)
-            : ProtoBase(src), mValue(src.mValue), mValueInitial(src.mValueInitial), mValueDefault(src.mValueDefault)
+            : ProtoBase(src), mAliasState(owned)
+            {
+                copyValue(src);
+            }
+
+            ProtoStringType (ProtoStringType && src) noexcept
+            : ProtoBase(std::move(src)), mValue(std::move(src.mValue)), mAlias(src.mAlias),
+              mAliasState(src.mAliasState.load(std::memory_order_relaxed))
             {
             }
 
@@ -3064,46 +4697,116 @@ R"MuddledManaged(namespace MuddledManaged
 
                 ProtoBase::operator=(rhs);
 
-                mValue = rhs.mValue;
-                mValueInitial = rhs.mValueInitial;
-                mValueDefault = rhs.mValueDefault;
+                copyValue(rhs);
+
+                return *this;
+            }
+
+            ProtoStringType & operator = (ProtoStringType && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(std::move(rhs));
+
+                mValue = std::move(rhs.mValue);
+                mAlias = rhs.mAlias;
+                mAliasState.store(rhs.mAliasState.load(std::memory_order_relaxed), std::memory_order_relaxed);
 
                 return *this;
             }
 
         private:
-            std::string mValue;
-            std::string mValueInitial;
-            std::string mValueDefault;
+            enum AliasState
+            {
+                owned,
+                aliased,
+                copying
+            };
+
+            // Only the thread that moves the state from aliased to copying writes the string. Any other thread
+            // reading at the same time waits until the copy is done.
+            void copyAlias () const
+            {
+                int expected = aliased;
+                if (mAliasState.compare_exchange_strong(expected, copying, std::memory_order_acquire))
+                {
+                    mValue.assign(mAlias.data(), mAlias.size());
+                    mAliasState.store(owned, std::memory_order_release);
+                    return;
+                }
+                while (mAliasState.load(std::memory_order_acquire) != owned)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            // The source can be copying its alias on another thread, so an aliased source is copied as an alias.
+            void copyValue (const ProtoStringType & src)
+            {
+                mAlias = src.mAlias;
+                if (src.mAliasState.load(std::memory_order_acquire) != owned)
+                {
+                    mAliasState.store(aliased, std::memory_order_relaxed);
+                    return;
+                }
+                mValue = src.mValue;
+                mAliasState.store(owned, std::memory_order_relaxed);
+            }
+
+            mutable std::string mValue;
+            ByteView mAlias;
+            mutable std::atomic<int> mAliasState;
         };
 
+        // Values can be shared with copies of the collection, so a shared value is replaced instead of changed.
+        // Clearing keeps the values past the end so that adding or parsing values later can reuse their storage.
         template <typename ProtoType>
         class ProtoStringTypeCollection : public ProtoBase
         {
         public:
-            virtual const std::string & value (size_t index) const
+            const std::string & value (size_t index) const
             {
                 return mCollection[index]->value();
             }
 
-            virtual void setValue (size_t index, const std::string & value)
+            ByteView view (size_t index) const
             {
-                std::shared_ptr<ProtoType> newValue(new ProtoType(mValueDefault));
+                return mCollection[index]->view();
+            }
 
-                newValue->setIndex(this->index());
-                newValue->setValue(value);
-                
-                mCollection[index] = newValue;
+            void setValue (size_t index, const std::string & value)
+            {
+                ownedValue(index).setValue(value);
             }
-            
-            virtual void addValue (const std::string & value)
+
+            void addValue (const std::string & value)
             {
-                std::shared_ptr<ProtoType> newValue(new ProtoType(mValueDefault));
+                nextValue().setValue(value);
+                ++mSize;
+            }
 
-                newValue->setIndex(this->index());
-                newValue->setValue(value);
+            void setValue (size_t index, std::string && value)
+            {
+                ownedValue(index).setValue(std::move(value));
+            }
+
+            void addValue (std::string && value)
+            {
+                nextValue().setValue(std::move(value));
+                ++mSize;
+            }
+
+            std::string & mutableValue (size_t index)
+            {
+                return ownedValue(index).mutableValue();
+            }
 
-                mCollection.push_back(newValue);
+            void setArena (Arena * pArena)
+            {
+                mArena = pArena;
             }
 
             virtual unsigned int key () const
@@ -3111,53 +4814,57 @@ R"MuddledManaged(namespace MuddledManaged
                 return (this->index() << 3) | 0x02;
             }
 
-            virtual size_t parse (const char * pData)
+            virtual size_t parse (const char * pData, size_t available)
             {
-                std::shared_ptr<ProtoType> value(new ProtoType());
-                size_t bytesParsed = value->parse(pData);
-
-                mCollection.push_back(value);
+                size_t bytesParsed = nextValue().parse(pData, available);
+                ++mSize;
 
                 return bytesParsed;
             }
 
-            virtual std::string serialize () const
+            virtual size_t parseAliased (const char * pData, size_t available)
             {
-                std::string result;
+                size_t bytesParsed = nextValue().parseAliased(pData, available);
+                ++mSize;
+
+                return bytesParsed;
+            }
 
-                for (auto & value : mCollection)
+            virtual char * writeTo (char * pData, const char * pTag, unsigned int tagSize) const
+            {
+                for (size_t i = 0; i < mSize; ++i)
                 {
-                    result += value->serialize();
+                    pData = mCollection[i]->writeTo(pData, pTag, tagSize);
                 }
 
-                return result;
+                return pData;
             }
 
-            virtual size_t byteSize () const
+            virtual size_t byteSize (unsigned int tagSize) const
             {
                 size_t result = 0;
 
-                for (auto & value : mCollection)
+                for (size_t i = 0; i < mSize; ++i)
                 {
-                    result += value->byteSize();
+                    result += mCollection[i]->byteSize(tagSize);
                 }
 
                 return result;
             }
 
-            virtual size_t size () const
+            size_t size () const
             {
-                return mCollection.size();
+                return mSize;
             }
 
-            virtual bool hasValue () const
+            bool hasValue () const
             {
-                return !mCollection.empty();
+                return mSize != 0;
             }
 
-            virtual void clearValue ()
+            void clearValue ()
             {
-                mCollection.clear();
+                mSize = 0;
             }
 
             virtual bool valid () const
@@ -3165,29 +4872,96 @@ R"MuddledManaged(namespace MuddledManaged
                 return true;
             }
 
+            ProtoStringTypeCollection<ProtoType> & operator = (const ProtoStringTypeCollection<ProtoType> & rhs)
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(rhs);
+
+                mCollection.assign(rhs.mCollection.begin(), rhs.mCollection.begin() + rhs.mSize);
+                mSize = rhs.mSize;
+                mArena = rhs.mArena;
+
+                return *this;
+            }
+
+            ProtoStringTypeCollection<ProtoType> & operator = (ProtoStringTypeCollection<ProtoType> && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoBase::operator=(std::move(rhs));
+
+                mCollection = std::move(rhs.mCollection);
+                mSize = rhs.mSize;
+                mArena = rhs.mArena;
+                rhs.mSize = 0;
+
+                return *this;
+            }
+
         protected:
-            ProtoStringTypeCollection (const std::string & defaultValue)
-            : mValueDefault(defaultValue)
+            ProtoStringTypeCollection ()
+            : mSize(0), mArena(nullptr)
             {}
 
+            ProtoStringTypeCollection (const ProtoStringTypeCollection<ProtoType> & src)
+            : ProtoBase(src), mCollection(src.mCollection.begin(), src.mCollection.begin() + src.mSize), mSize(src.mSize),
+              mArena(src.mArena)
+            {}
+
+            ProtoStringTypeCollection (ProtoStringTypeCollection<ProtoType> && src) noexcept
+            : ProtoBase(std::move(src)), mCollection(std::move(src.mCollection)), mSize(src.mSize), mArena(src.mArena)
+            {
+                src.mSize = 0;
+            }
+
             virtual const std::vector<std::shared_ptr<ProtoType>> * collection () const
             {
                 return &mCollection;
             }
 
         private:
-            ProtoStringTypeCollection (const ProtoStringTypeCollection<ProtoType> & src) = delete;
-            ProtoStringTypeCollection<ProtoType> & operator = (const ProtoStringTypeCollection<ProtoType> & rhs) = delete;
+            // Returns the value at index after making sure no copy of the collection shares it.
+            ProtoType & ownedValue (size_t index)
+            {
+                if (mCollection[index].use_count() > 1)
+                {
+                    mCollection[index] = makeShared<ProtoType>(mArena, *mCollection[index]);
+                }
+                return *mCollection[index];
+            }
+
+            // Returns a value at the end for adding or parsing, reusing one left from before when nothing shares it.
+            ProtoType & nextValue ()
+            {
+                if (mSize == mCollection.size())
+                {
+                    mCollection.push_back(nullptr);
+                }
+                if (mCollection[mSize] == nullptr || mCollection[mSize].use_count() > 1)
+                {
+                    mCollection[mSize] = makeShared<ProtoType>(mArena);
+                    mCollection[mSize]->setIndex(this->index());
+                }
+
+                return *mCollection[mSize];
+            }
 
             std::vector<std::shared_ptr<ProtoType>> mCollection;
-            std::string mValueDefault;
+            size_t mSize;
+            Arena * mArena;
         };
 
-        class ProtoString : public ProtoStringType
+        class ProtoString final : public ProtoStringType
         {
         public:
-            explicit ProtoString (const std::string & defaultValue = "")
-            : ProtoStringType("", defaultValue)
+            explicit ProtoString ()
             {}
 
             ProtoString (const ProtoString & src)
@@ -3206,21 +4980,36 @@ R"MuddledManaged(namespace MuddledManaged
 
                 return *this;
             }
+
+            ProtoString (ProtoString && src) noexcept
+            : ProtoStringType(std::move(src))
+            {
+            }
+
+            ProtoString & operator = (ProtoString && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoStringType::operator=(std::move(rhs));
+
+                return *this;
+            }
         };
 
-        class ProtoStringCollection : public ProtoStringTypeCollection<ProtoString>
+        class ProtoStringCollection final : public ProtoStringTypeCollection<ProtoString>
         {
         public:
-            explicit ProtoStringCollection (const std::string & defaultValue = "")
-            : ProtoStringTypeCollection<ProtoString>(defaultValue)
+            explicit ProtoStringCollection ()
             {}
         };
 
-        class ProtoBytes : public ProtoStringType
+        class ProtoBytes final : public ProtoStringType
         {
         public:
-            explicit ProtoBytes (const std::string & defaultValue = "")
-            : ProtoStringType("", defaultValue)
+            explicit ProtoBytes ()
             {}
 
             ProtoBytes (const ProtoBytes & src)
@@ -3239,15 +5028,243 @@ R"MuddledManaged(namespace MuddledManaged
 
                 return *this;
             }
+
+            ProtoBytes (ProtoBytes && src) noexcept
+            : ProtoStringType(std::move(src))
+            {
+            }
+
+            ProtoBytes & operator = (ProtoBytes && rhs) noexcept
+            {
+                if (this == &rhs)
+                {
+                    return *this;
+                }
+
+                ProtoStringType::operator=(std::move(rhs));
+
+                return *this;
+            }
         };
 
-        class ProtoBytesCollection : public ProtoStringTypeCollection<ProtoBytes>
+        class ProtoBytesCollection final : public ProtoStringTypeCollection<ProtoBytes>
         {
         public:
-            explicit ProtoBytesCollection (const std::string & defaultValue = "")
-            : ProtoStringTypeCollection<ProtoBytes>(defaultValue)
+            explicit ProtoBytesCollection ()
             {}
         };
+
+        // Selects how the shared table parser calls a field. Singular fields of the built in types are called
+        // through their concrete class so the parse can be inlined. Everything else uses the virtual parse.
+        enum class FieldKind
+        {
+            boolKind,
+            int32Kind,
+            int64Kind,
+            unsignedInt32Kind,
+            unsignedInt64Kind,
+            signedInt32Kind,
+            signedInt64Kind,
+            fixedInt32Kind,
+            fixedInt64Kind,
+            floatKind,
+            doubleKind,
+            stringKind,
+            otherKind
+        };
+
+        // The select function marks the field present after it is parsed. It sets the presence bit of the field or
+        // the choice of its oneof. Repeated fields have none.
+        struct FieldTableEntry
+        {
+            unsigned int index;
+            unsigned int wireType;
+            FieldKind kind;
+            ProtoBase * (* field) (void * pMessageData);
+            void (* select) (void * pMessageData);
+        };
+
+        // Describes the fields of a message generated with optimize_for = CODE_SIZE. The entries are sorted by
+        // index. When the indexes are small enough, denseLookup holds the entry position plus one for every
+        // index below denseCount so the lookup is a single load. Otherwise denseLookup is null and the entries
+        // are searched.
+        struct FieldTable
+        {
+            const FieldTableEntry * entries;
+            size_t entryCount;
+            const unsigned short * denseLookup;
+            size_t denseCount;
+        };
+
+        class FieldTableParser
+        {
+        public:
+            static size_t parse (const FieldTable & table, void * pMessageData, const char * pData, size_t available, bool aliased,
+                                 std::string * pUnknownFields)
+            {
+                if (pData == nullptr)
+                {
+                    throw std::invalid_argument("pData cannot be null.");
+                }
+
+                size_t lengthBytesParsed = 0;
+                std::uint32_t length = PrimitiveEncoding::parseVariableUnsignedInt32(pData, available, &lengthBytesParsed);
+                pData += lengthBytesParsed;
+
+                if (length > available - lengthBytesParsed)
+                {
+                    throw ProtocolBufferException("Message length exceeds available data.");
+                }
+
+                std::uint32_t remainingBytes = length;
+                while (remainingBytes)
+                {
+                    size_t fieldKeyBytesParsed = 0;
+                    std::uint32_t fieldKey = PrimitiveEncoding::parseVariableUnsignedInt32(pData, remainingBytes, &fieldKeyBytesParsed);
+                    pData += fieldKeyBytesParsed;
+                    remainingBytes -= fieldKeyBytesParsed;
+
+                    size_t fieldBytesParsed = parseField(table, pMessageData, fieldKey, pData, remainingBytes, aliased, pUnknownFields);
+
+                    if (fieldBytesParsed > remainingBytes)
+                    {
+                        throw ProtocolBufferException("Field exceeds available data.");
+                    }
+
+                    pData += fieldBytesParsed;
+                    remainingBytes -= fieldBytesParsed;
+                }
+
+                return lengthBytesParsed + length;
+            }
+
+            static size_t parseField (const FieldTable & table, void * pMessageData, std::uint32_t fieldKey, const char * pData, size_t available,
+                                      bool aliased, std::string * pUnknownFields)
+            {
+                // A field that arrives with a different wire type than expected is kept as an unknown field.
+                const FieldTableEntry * pEntry = find(table, fieldKey >> 3);
+                if (pEntry != nullptr && pEntry->wireType == (fieldKey & 0x07))
+                {
+                    return parseEntry(*pEntry, pMessageData, pData, available, aliased);
+                }
+                return UnknownFields::parse(fieldKey, pData, available, pUnknownFields);
+            }
+
+        private:
+            static const FieldTableEntry * find (const FieldTable & table, unsigned int index)
+            {
+                if (table.denseLookup != nullptr)
+                {
+                    if (index >= table.denseCount || table.denseLookup[index] == 0)
+                    {
+                        return nullptr;
+                    }
+                    return &table.entries[table.denseLookup[index] - 1];
+                }
+
+                size_t first = 0;
+                size_t last = table.entryCount;
+                while (first < last)
+                {
+                    size_t middle = first + (last - first) / 2;
+                    if (table.entries[middle].index < index)
+                    {
+                        first = middle + 1;
+                    }
+                    else
+                    {
+                        last = middle;
+                    }
+                }
+                if (first == table.entryCount || table.entries[first].index != index)
+                {
+                    return nullptr;
+                }
+                return &table.entries[first];
+            }
+
+            static size_t parseEntry (const FieldTableEntry & entry, void * pMessageData, const char * pData, size_t available, bool aliased)
+            {
+                ProtoBase * pField = entry.field(pMessageData);
+
+                size_t bytesParsed = 0;
+                switch (entry.kind)
+                {
+                    case FieldKind::boolKind:
+                        bytesParsed = static_cast<ProtoBool *>(pField)->ProtoBool::parse(pData, available);
+                        break;
+
+                    case FieldKind::int32Kind:
+                        bytesParsed = static_cast<ProtoInt32 *>(pField)->ProtoInt32::parse(pData, available);
+                        break;
+
+                    case FieldKind::int64Kind:
+                        bytesParsed = static_cast<ProtoInt64 *>(pField)->ProtoInt64::parse(pData, available);
+                        break;
+
+                    case FieldKind::unsignedInt32Kind:
+                        bytesParsed = static_cast<ProtoUnsignedInt32 *>(pField)->ProtoUnsignedInt32::parse(pData, available);
+                        break;
+
+                    case FieldKind::unsignedInt64Kind:
+                        bytesParsed = static_cast<ProtoUnsignedInt64 *>(pField)->ProtoUnsignedInt64::parse(pData, available);
+                        break;
+
+                    case FieldKind::signedInt32Kind:
+                        bytesParsed = static_cast<ProtoSignedInt32 *>(pField)->ProtoSignedInt32::parse(pData, available);
+                        break;
+
+                    case FieldKind::signedInt64Kind:
+                        bytesParsed = static_cast<ProtoSignedInt64 *>(pField)->ProtoSignedInt64::parse(pData, available);
+                        break;
+
+                    case FieldKind::fixedInt32Kind:
+                        bytesParsed = static_cast<ProtoFixedInt32 *>(pField)->ProtoFixedInt32::parse(pData, available);
+                        break;
+
+                    case FieldKind::fixedInt64Kind:
+                        bytesParsed = static_cast<ProtoFixedInt64 *>(pField)->ProtoFixedInt64::parse(pData, available);
+                        break;
+
+                    case FieldKind::floatKind:
+                        bytesParsed = static_cast<ProtoFloat *>(pField)->ProtoFloat::parse(pData, available);
+                        break;
+
+                    case FieldKind::doubleKind:
+                        bytesParsed = static_cast<ProtoDouble *>(pField)->ProtoDouble::parse(pData, available);
+                        break;
+
+                    case FieldKind::stringKind:
+                        if (aliased)
+                        {
+                            bytesParsed = static_cast<ProtoStringType *>(pField)->ProtoStringType::parseAliased(pData, available);
+                        }
+                        else
+                        {
+                            bytesParsed = static_cast<ProtoStringType *>(pField)->ProtoStringType::parse(pData, available);
+                        }
+                        break;
+
+                    default:
+                        if (aliased)
+                        {
+                            bytesParsed = pField->parseAliased(pData, available);
+                        }
+                        else
+                        {
+                            bytesParsed = pField->parse(pData, available);
+                        }
+                        break;
+                }
+
+                if (entry.select != nullptr)
+                {
+                    entry.select(pMessageData);
+                }
+
+                return bytesParsed;
+            }
+        };
     }
 }
 )MuddledManaged";
\ No newline at end of file
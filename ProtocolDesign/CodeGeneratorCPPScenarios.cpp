@@ -195,6 +195,78 @@ DESIGNER_SCENARIO( CodeGeneratorCPP, "Operation/Normal", "CPP generator can crea
     generator->generateCode("Generated", model.get(), "ProtocolDesign");
 }
 
+DESIGNER_SCENARIO( CodeGeneratorCPP, "Operation/Normal", "CPP generator can create file with messages optimized for code size." )
+{
+    Protocol::CodeGeneratorManager * pManager = Protocol::CodeGeneratorManager::instance();
+
+    auto generator = pManager->generator("CPlusPlus");
+
+    Protocol::ProtoParser parser("MessageCodeSize.proto");
+    auto model = parser.parse();
+
+    generator->generateCode("Generated", model.get(), "ProtocolDesign");
+}
+
+DESIGNER_SCENARIO( CodeGeneratorCPP, "Operation/Normal", "CPP generator can create file with lazy message fields." )
+{
+    Protocol::CodeGeneratorManager * pManager = Protocol::CodeGeneratorManager::instance();
+
+    auto generator = pManager->generator("CPlusPlus");
+
+    Protocol::ProtoParser parser("MessageLazy.proto");
+    auto model = parser.parse();
+
+    generator->generateCode("Generated", model.get(), "ProtocolDesign");
+}
+
+DESIGNER_SCENARIO( CodeGeneratorCPP, "Operation/Normal", "CPP generator can create file with inline message storage." )
+{
+    Protocol::CodeGeneratorManager * pManager = Protocol::CodeGeneratorManager::instance();
+
+    auto generator = pManager->generator("CPlusPlus");
+
+    Protocol::ProtoParser parser("MessageInline.proto");
+    auto model = parser.parse();
+
+    generator->generateCode("Generated", model.get(), "ProtocolDesign");
+}
+
+DESIGNER_SCENARIO( CodeGeneratorCPP, "Operation/Normal", "CPP generator can create file with epoch presence." )
+{
+    Protocol::CodeGeneratorManager * pManager = Protocol::CodeGeneratorManager::instance();
+
+    auto generator = pManager->generator("CPlusPlus");
+
+    Protocol::ProtoParser parser("MessageEpoch.proto");
+    auto model = parser.parse();
+
+    generator->generateCode("Generated", model.get(), "ProtocolDesign");
+}
+
+DESIGNER_SCENARIO( CodeGeneratorCPP, "Operation/Normal", "CPP generator can create file with repeated message fields." )
+{
+    Protocol::CodeGeneratorManager * pManager = Protocol::CodeGeneratorManager::instance();
+
+    auto generator = pManager->generator("CPlusPlus");
+
+    Protocol::ProtoParser parser("MessageRepeated.proto");
+    auto model = parser.parse();
+
+    generator->generateCode("Generated", model.get(), "ProtocolDesign");
+}
+
+DESIGNER_SCENARIO( CodeGeneratorCPP, "Operation/Normal", "CPP generator can create file with default field values." )
+{
+    Protocol::CodeGeneratorManager * pManager = Protocol::CodeGeneratorManager::instance();
+
+    auto generator = pManager->generator("CPlusPlus");
+
+    Protocol::ProtoParser parser("MessageDefault.proto");
+    auto model = parser.parse();
+
+    generator->generateCode("Generated", model.get(), "ProtocolDesign");
+}
+
 namespace A
 {
     namespace B
@@ -0,0 +1,106 @@
+//
+//  MessageCodeSizeScenarios.cpp
+//  Protocol
+//
+//  Created by agent on 10/17/26.
+//
+
+#include <string>
+
+#include "../Submodules/Designer/Designer/Designer.h"
+
+#include "../ProtocolDesign/Messages/Generated/MessageCodeSize.protocol.h"
+
+using namespace std;
+using namespace MuddledManaged;
+
+DESIGNER_SCENARIO( MessageCodeSize, "Parsing/Table", "Generated class optimized for code size can be parsed from its field table." )
+{
+    MessageCodeSize originalMessage;
+    originalMessage.setSOne("managed");
+    originalMessage.setBOne(true);
+    originalMessage.addIOne(-5);
+    originalMessage.addIOne(300);
+    originalMessage.setLOne(-70000000000);
+    originalMessage.setFOne(17);
+    originalMessage.setDOne(2.5);
+    originalMessage.createNewMOne().setIOne(42);
+    originalMessage.setITwo(9);
+
+    string serialized = originalMessage.serialize();
+
+    MessageCodeSize parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyEqual("managed", parsedMessage.sOne());
+    verifyTrue(parsedMessage.hasBOne());
+    verifyTrue(parsedMessage.bOne());
+    verifyFalse(parsedMessage.hasIThree());
+    verifyTrue(parsedMessage.hasITwo());
+    verifyFalse(parsedMessage.hasSTwo());
+    verifyEqual(2, parsedMessage.sizeIOne());
+    verifyEqual(-5, parsedMessage.iOne(0));
+    verifyEqual(300, parsedMessage.iOne(1));
+    verifyEqual(-70000000000, parsedMessage.lOne());
+    verifyEqual(17, parsedMessage.fOne());
+    verifyTrue(parsedMessage.dOne() == 2.5);
+    verifyEqual(42, parsedMessage.mOne().iOne());
+    verifyTrue(parsedMessage.currentChoicesCodeSizeChoice() == MessageCodeSize::ChoicesCodeSizeChoices::iTwo);
+    verifyEqual(9, parsedMessage.iTwo());
+    verifyEqual(serialized, parsedMessage.serialize());
+}
+
+DESIGNER_SCENARIO( MessageCodeSize, "Parsing/Unknown", "Generated class optimized for code size keeps unknown fields and finds sparse fields." )
+{
+    MessageCodeSize originalMessage;
+    originalMessage.setSOne("managed");
+    originalMessage.addIOne(300);
+    originalMessage.setSTwo("choice");
+
+    string serialized = originalMessage.serialize();
+
+    MessageCodeSizeSparse parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyEqual("managed", parsedMessage.sOne());
+    verifyFalse(parsedMessage.hasIOne());
+
+    string forwarded = parsedMessage.serialize();
+
+    verifyEqual(serialized.size(), forwarded.size());
+
+    MessageCodeSize forwardedMessage;
+    forwardedMessage.parse(forwarded.data(), forwarded.size());
+
+    verifyEqual("managed", forwardedMessage.sOne());
+    verifyEqual(300, forwardedMessage.iOne(0));
+    verifyEqual("choice", forwardedMessage.sTwo());
+
+    MessageCodeSizeSparse sparseMessage;
+    sparseMessage.setIOne(200);
+
+    serialized = sparseMessage.serialize();
+
+    MessageCodeSizeSparse parsedSparseMessage;
+    parsedSparseMessage.parse(serialized.data(), serialized.size());
+
+    verifyTrue(parsedSparseMessage.hasIOne());
+    verifyEqual(200, parsedSparseMessage.iOne());
+}
+
+DESIGNER_SCENARIO( MessageCodeSize, "Construction/Valid", "Generated class optimized for code size is only valid when required fields are set." )
+{
+    MessageCodeSize message;
+    verifyFalse(message.valid());
+
+    message.setBOne(true);
+    verifyFalse(message.valid());
+
+    message.setSOne("required");
+    verifyTrue(message.valid());
+
+    message.clearSOne();
+    verifyFalse(message.valid());
+}
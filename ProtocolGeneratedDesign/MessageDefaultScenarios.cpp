@@ -0,0 +1,132 @@
+//
+//  MessageDefaultScenarios.cpp
+//  Protocol
+//
+//  Created by agent on 10/17/26.
+//
+
+#include <string>
+
+#include "../Submodules/Designer/Designer/Designer.h"
+
+#include "../ProtocolDesign/Messages/Generated/MessageDefault.protocol.h"
+#include "../ProtocolDesign/Messages/Generated/MessageCodeSize.protocol.h"
+#include "../ProtocolDesign/Messages/Generated/MessageEpoch.protocol.h"
+
+using namespace std;
+using namespace MuddledManaged;
+
+DESIGNER_SCENARIO( MessageDefault, "Construction/Normal", "Generated class reads fields that are not set as their defaults." )
+{
+    MessageDefault message;
+
+    verifyFalse(message.hasEOne());
+    verifyTrue(EnumDefault::second == message.eOne());
+    verifyEqual(2.5, message.dOne());
+    verifyEqual(-3, message.lOne());
+    verifyTrue(message.bOne());
+    verifyEqual(string("managed"), message.sOne());
+    verifyEqual(string("managed"), message.sOneView().toString());
+    verifyEqual(string("raw"), message.yOne());
+    verifyEqual(0, message.iOne());
+    verifyEqual(string(""), message.sTwo());
+    verifyEqual(0, message.iTwo());
+    verifyEqual(string(1, '\0'), message.serialize());
+}
+
+DESIGNER_SCENARIO( MessageDefault, "Construction/Clear", "Generated class reads fields as their defaults again after clearing them." )
+{
+    MessageDefault message;
+    message.setEOne(EnumDefault::first);
+    message.setDOne(1.5);
+    message.setLOne(10);
+    message.setBOne(false);
+    message.setSOne("changed");
+    message.setYOne("bytes");
+    message.setIOne(5);
+    message.setITwo(6);
+
+    verifyTrue(EnumDefault::first == message.eOne());
+    verifyEqual(1.5, message.dOne());
+    verifyEqual(10, message.lOne());
+    verifyFalse(message.bOne());
+    verifyEqual(string("changed"), message.sOne());
+    verifyEqual(string("bytes"), message.yOne());
+    verifyEqual(6, message.iTwo());
+
+    message.clearLOne();
+    message.clearSOne();
+    verifyEqual(-3, message.lOne());
+    verifyEqual(string("managed"), message.sOne());
+    verifyEqual(1.5, message.dOne());
+
+    message.setSTwo("two");
+    verifyEqual(0, message.iTwo());
+
+    message.clear();
+    verifyTrue(EnumDefault::second == message.eOne());
+    verifyEqual(2.5, message.dOne());
+    verifyTrue(message.bOne());
+    verifyEqual(string("raw"), message.yOne());
+    verifyEqual(0, message.iOne());
+    verifyEqual(string(""), message.sTwo());
+}
+
+DESIGNER_SCENARIO( MessageDefault, "Construction/Mutable", "Generated class starts mutable strings from the default when they are not present." )
+{
+    MessageDefault message;
+    message.mutableSOne() += " protocol";
+    verifyEqual(string("managed protocol"), message.sOne());
+
+    message.clearSOne();
+    verifyEqual(string("managed"), message.mutableSOne());
+
+    message.setSTwo("two");
+    message.setITwo(2);
+    verifyFalse(message.hasSTwo());
+    verifyEqual(string(""), message.mutableSTwo());
+    verifyTrue(message.hasSTwo());
+}
+
+DESIGNER_SCENARIO( MessageDefault, "Parsing/Normal", "Generated class reads fields missing from parsed data as their defaults." )
+{
+    MessageDefault originalMessage;
+    originalMessage.setIOne(5);
+    string serialized = originalMessage.serialize();
+
+    MessageDefault parsedMessage;
+    parsedMessage.setLOne(10);
+    parsedMessage.clear();
+    parsedMessage.parse(serialized.data(), serialized.size());
+    verifyEqual(5, parsedMessage.iOne());
+    verifyEqual(-3, parsedMessage.lOne());
+    verifyEqual(string("managed"), parsedMessage.sOne());
+}
+
+DESIGNER_SCENARIO( MessageDefault, "Construction/CodeSize", "Generated class optimized for code size reads fields that are not set as their defaults." )
+{
+    MessageCodeSize message;
+    verifyEqual(9, message.iThree());
+
+    message.setIThree(1);
+    verifyEqual(1, message.iThree());
+
+    message.clear();
+    verifyEqual(9, message.iThree());
+}
+
+DESIGNER_SCENARIO( MessageDefault, "Construction/Epoch", "Generated class with epoch presence reads fields that are not set as their defaults." )
+{
+    MessageEpoch message;
+    verifyEqual(7, message.iThree());
+    verifyEqual(string("four"), message.sFour());
+
+    message.setIThree(1);
+    message.setSFour("changed");
+    verifyEqual(1, message.iThree());
+    verifyEqual(string("changed"), message.sFour());
+
+    message.clear();
+    verifyEqual(7, message.iThree());
+    verifyEqual(string("four"), message.sFour());
+}
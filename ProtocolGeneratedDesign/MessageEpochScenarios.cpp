@@ -0,0 +1,130 @@
+//
+//  MessageEpochScenarios.cpp
+//  Protocol
+//
+//  Created by agent on 10/17/26.
+//
+
+#include <string>
+
+#include "../Submodules/Designer/Designer/Designer.h"
+
+#include "../ProtocolDesign/Messages/Generated/MessageEpoch.protocol.h"
+
+using namespace std;
+using namespace MuddledManaged;
+
+DESIGNER_SCENARIO( MessageEpoch, "Construction/Clear", "Generated class with epoch presence clears every field." )
+{
+    MessageEpoch message;
+    message.setSOne("one");
+    message.addIOne(1);
+    message.createNewMOne().setIOne(10);
+    message.setSTwo("two");
+    message.addSThree("three");
+    message.setIThree(3);
+
+    message.clear();
+
+    verifyFalse(message.hasSOne());
+    verifyEqual(string(""), message.sOne());
+    verifyEqual(0, message.sizeIOne());
+    verifyFalse(message.hasMOne());
+    verifyTrue(MessageEpoch::ChoicesEpochChoices::none == message.currentChoicesEpochChoice());
+    verifyFalse(message.hasSTwo());
+    verifyEqual(0, message.sizeSThree());
+    verifyFalse(message.hasIThree());
+    verifyEqual(MessageEpoch().iThree(), message.iThree());
+    verifyEqual(MessageEpoch().serialize(), message.serialize());
+}
+
+DESIGNER_SCENARIO( MessageEpoch, "Construction/Reuse", "Generated class with epoch presence can be used again after clear." )
+{
+    MessageEpoch message;
+    for (int i = 0; i < 3; ++i)
+    {
+        message.clear();
+        verifyEqual(0, message.sizeIOne());
+
+        message.addIOne(i);
+        message.addIOne(i + 1);
+        message.createNewMOne().setIOne(i);
+        message.setITwo(i);
+
+        verifyEqual(2, message.sizeIOne());
+        verifyEqual(i + 1, message.iOne(1));
+        verifyEqual(i, message.mOne().iOne());
+        verifyTrue(message.hasITwo());
+        verifyEqual(i, message.iTwo());
+        verifyFalse(message.hasSOne());
+    }
+}
+
+DESIGNER_SCENARIO( MessageEpoch, "Parsing/Reuse", "Generated class with epoch presence parses after clear." )
+{
+    MessageEpoch originalMessage;
+    originalMessage.setSOne("one");
+    originalMessage.addIOne(1);
+    originalMessage.createNewMOne().setIOne(10);
+    originalMessage.setITwo(2);
+
+    string serialized = originalMessage.serialize();
+
+    MessageEpoch parsedMessage;
+    parsedMessage.setSTwo("two");
+    parsedMessage.addSThree("three");
+    parsedMessage.addIOne(5);
+    for (int i = 0; i < 3; ++i)
+    {
+        parsedMessage.clear();
+        parsedMessage.parse(serialized.data(), serialized.size());
+
+        verifyEqual(string("one"), parsedMessage.sOne());
+        verifyEqual(1, parsedMessage.sizeIOne());
+        verifyEqual(1, parsedMessage.iOne(0));
+        verifyEqual(10, parsedMessage.mOne().iOne());
+        verifyTrue(parsedMessage.hasITwo());
+        verifyEqual(0, parsedMessage.sizeSThree());
+        verifyEqual(serialized, parsedMessage.serialize());
+    }
+}
+
+DESIGNER_SCENARIO( MessageEpoch, "Construction/Default", "Generated class with epoch presence starts mutable strings from the default." )
+{
+    MessageEpoch message;
+    verifyFalse(message.hasSFour());
+
+    message.mutableSFour() += "teen";
+    verifyTrue(message.hasSFour());
+    verifyEqual(string("fourteen"), message.sFour());
+
+    message.clear();
+    verifyFalse(message.hasSFour());
+
+    message.mutableSFour() += "th";
+    verifyEqual(string("fourth"), message.sFour());
+}
+
+DESIGNER_SCENARIO( MessageEpoch, "Serialization/ConstRead", "Generated class with epoch presence reads stale fields as empty." )
+{
+    MessageEpoch message;
+    message.addIOne(1);
+    message.addIOne(2);
+    message.addSThree("three");
+    message.setSOne("one");
+
+    message.clear();
+
+    const MessageEpoch & constMessage = message;
+    verifyEqual(0, constMessage.sizeIOne());
+    verifyEqual(0, constMessage.iOneValues().size());
+    verifyEqual(0, constMessage.sizeSThree());
+    verifyFalse(constMessage.hasSOne());
+    verifyEqual(string(""), constMessage.sOne());
+    verifyEqual(MessageEpoch().serialize(), constMessage.serialize());
+
+    message.addIOne(3);
+    verifyEqual(1, constMessage.sizeIOne());
+    verifyEqual(3, constMessage.iOne(0));
+    verifyEqual(0, constMessage.sizeSThree());
+}
@@ -11,6 +11,11 @@
 #include <iostream>
 #include <iterator>
 #include <iomanip>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+#include <utility>
+#include <thread>
 
 #include "../Submodules/Designer/Designer/Designer.h"
 
@@ -44,3 +49,462 @@ DESIGNER_SCENARIO( MessageField, "Serialization/Normal", "Generated class can be
     verifyEqual(stringValue, parsedMessage.sOne());
     verifyEqual(42, parsedMessage.iOne(0));
 }
+
+DESIGNER_SCENARIO( MessageField, "Parsing/Bounded", "Generated class will not parse past the available bytes." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("managed");
+    originalMessage.addIOne(42);
+
+    string serialized = originalMessage.serialize();
+
+    MessageOne parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyEqual(string("managed"), parsedMessage.sOne());
+
+    for (size_t available = 0; available < serialized.size(); ++available)
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            MessageOne truncatedMessage;
+            truncatedMessage.parse(serialized.data(), available);
+        }
+        catch (const Protocol::ProtocolBufferException &)
+        {
+            exceptionThrown = true;
+        }
+        verifyTrue(exceptionThrown);
+    }
+}
+
+DESIGNER_SCENARIO( MessageField, "Serialization/Append", "Generated class can be serialized into existing storage." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("managed");
+    originalMessage.addIOne(42);
+
+    string serialized = originalMessage.serialize();
+    verifyEqual(serialized.size(), originalMessage.byteSize());
+
+    string appended = "prefix";
+    originalMessage.serializeTo(appended);
+    verifyEqual(string("prefix") + serialized, appended);
+
+    char buffer[64];
+    size_t bytesWritten = originalMessage.serializeToArray(buffer, sizeof(buffer));
+    verifyEqual(serialized, string(buffer, bytesWritten));
+
+    bool exceptionThrown = false;
+    try
+    {
+        originalMessage.serializeToArray(buffer, serialized.size() - 1);
+    }
+    catch (const Protocol::ProtocolBufferException &)
+    {
+        exceptionThrown = true;
+    }
+    verifyTrue(exceptionThrown);
+}
+
+DESIGNER_SCENARIO( MessageField, "Serialization/ByteSize", "Generated class byte size follows changes made after it was computed." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("managed");
+
+    size_t originalSize = originalMessage.byteSize();
+
+    originalMessage.setSOne("muddled managed");
+    originalMessage.addIOne(42);
+
+    string serialized = originalMessage.serialize();
+    verifyTrue(serialized.size() > originalSize);
+    verifyEqual(serialized.size(), originalMessage.byteSize());
+
+    MessageOne parsedMessage;
+    parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(string("muddled managed"), parsedMessage.sOne());
+    verifyEqual(42, parsedMessage.iOne(0));
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/Packed", "Generated class can parse long packed runs with mixed VarInt lengths." )
+{
+    MessageOne originalMessage;
+    for (int i = 0; i < 300; ++i)
+    {
+        originalMessage.addIOne((i % 3 == 0) ? -i * 1000003 : i * 127);
+    }
+
+    string serialized = originalMessage.serialize();
+
+    MessageOne parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyEqual(300u, parsedMessage.sizeIOne());
+    for (int i = 0; i < 300; ++i)
+    {
+        verifyEqual(originalMessage.iOne(i), parsedMessage.iOne(i));
+    }
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/Aliased", "Generated class can parse strings that refer to the input buffer." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("muddled managed");
+    originalMessage.addIOne(42);
+
+    string serialized = originalMessage.serialize();
+
+    MessageOne parsedMessage;
+    size_t bytesParsed = parsedMessage.parseAliased(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyTrue(parsedMessage.sOneView().data() >= serialized.data());
+    verifyTrue(parsedMessage.sOneView().data() < serialized.data() + serialized.size());
+    verifyEqual(string("muddled managed"), parsedMessage.sOneView().toString());
+    verifyEqual(serialized, parsedMessage.serialize());
+
+    verifyEqual(string("muddled managed"), parsedMessage.sOne());
+
+    parsedMessage.setSOne("managed");
+    serialized.assign(serialized.size(), '\0');
+
+    verifyEqual(string("managed"), parsedMessage.sOneView().toString());
+    verifyEqual(42, parsedMessage.iOne(0));
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/AliasedConst", "Generated class can read aliased strings from several threads." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("muddled managed");
+
+    string serialized = originalMessage.serialize();
+
+    MessageOne parsedMessage;
+    parsedMessage.parseAliased(serialized.data(), serialized.size());
+
+    const MessageOne & constMessage = parsedMessage;
+    vector<string> values(4);
+    vector<string> views(4);
+    vector<thread> readers;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        readers.push_back(thread([&constMessage, &values, &views, i] ()
+        {
+            views[i] = constMessage.sOneView().toString();
+            values[i] = constMessage.sOne();
+        }));
+    }
+    for (auto & reader: readers)
+    {
+        reader.join();
+    }
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        verifyEqual(string("muddled managed"), values[i]);
+        verifyEqual(string("muddled managed"), views[i]);
+    }
+    verifyEqual(serialized, constMessage.serialize());
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/Arena", "Generated class can be allocated from an arena." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("muddled managed");
+    originalMessage.addIOne(42);
+
+    string serialized = originalMessage.serialize();
+
+    Protocol::Arena arena;
+    {
+        MessageOne parsedMessage(&arena);
+        parsedMessage.parse(serialized.data(), serialized.size());
+
+        verifyTrue(parsedMessage.arena() == &arena);
+        verifyEqual(1u, arena.blockCount());
+        verifyEqual(string("muddled managed"), parsedMessage.sOne());
+        verifyEqual(42, parsedMessage.iOne(0));
+
+        parsedMessage.clear();
+
+        verifyTrue(parsedMessage.arena() == &arena);
+        verifyFalse(parsedMessage.hasSOne());
+    }
+}
+
+DESIGNER_SCENARIO( MessageField, "Collections/Contiguous", "Generated class stores repeated numbers contiguously." )
+{
+    vector<int32_t> numbers;
+    for (int i = 0; i < 100; ++i)
+    {
+        numbers.push_back(i * i - 50);
+    }
+
+    MessageOne originalMessage;
+    originalMessage.reserveIOne(numbers.size() + 1);
+    originalMessage.addIOne(7);
+    originalMessage.addIOneValues(numbers.begin(), numbers.end());
+
+    verifyEqual(101u, originalMessage.iOneValues().size());
+    verifyEqual(7, originalMessage.iOneValues()[0]);
+    verifyTrue(std::equal(numbers.begin(), numbers.end(), originalMessage.iOneValues().begin() + 1));
+
+    string serialized = originalMessage.serialize();
+
+    MessageOne parsedMessage;
+    parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(101u, parsedMessage.sizeIOne());
+    verifyEqual(0, std::memcmp(originalMessage.iOneValues().data(), parsedMessage.iOneValues().data(), 101 * sizeof(int32_t)));
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/Unknown", "Generated class keeps unknown fields and serializes them again." )
+{
+    // Field 1 is the string "a" and field 9 is an unknown VarInt with the value 150.
+    string serialized("\x06\x0a\x01\x61\x48\x96\x01", 7);
+
+    MessageOne parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyEqual("a", parsedMessage.sOne());
+    verifyEqual(3u, parsedMessage.unknownFields().size());
+    verifyEqual(serialized.size(), parsedMessage.byteSize());
+    verifyEqual(serialized, parsedMessage.serialize());
+
+    parsedMessage.clearUnknownFields();
+
+    verifyTrue(parsedMessage.unknownFields().empty());
+    verifyEqual(4u, parsedMessage.byteSize());
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/Incremental", "Generated class can be parsed from pieces that split fields anywhere." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne(string(300, 'x'));
+    originalMessage.setBOne(true);
+    for (int i = 0; i < 100; ++i)
+    {
+        originalMessage.addIOne(i * 1000 - 5);
+    }
+
+    string serialized = originalMessage.serialize();
+    // Another message follows in the same stream and must be left alone.
+    string stream = serialized + "\x02\x10\x01";
+
+    size_t pieceSizes[] = {1, 2, 3, 7, 64, 1000};
+    for (size_t pieceSize: pieceSizes)
+    {
+        MessageOne parsedMessage;
+        MuddledManaged::Protocol::IncrementalParser parser(parsedMessage);
+
+        size_t offset = 0;
+        while (!parser.complete())
+        {
+            size_t available = std::min(pieceSize, stream.size() - offset);
+            offset += parser.parse(stream.data() + offset, available);
+        }
+
+        verifyEqual(serialized.size(), offset);
+        verifyEqual(originalMessage.sOne(), parsedMessage.sOne());
+        verifyTrue(parsedMessage.bOne());
+        verifyEqual(100, parsedMessage.sizeIOne());
+        verifyEqual(98995, parsedMessage.iOne(99));
+        verifyEqual(serialized, parsedMessage.serialize());
+    }
+}
+
+DESIGNER_SCENARIO( MessageField, "Serialization/Delimited", "Generated class can be written to and read from a stream of messages." )
+{
+    stringstream stream;
+    {
+        // A small block forces messages to span blocks and a large message to grow the block.
+        Protocol::DelimitedWriter writer(stream, 16);
+        for (int i = 0; i < 50; ++i)
+        {
+            MessageOne message;
+            message.setSOne(string(i, 'x'));
+            message.addIOne(i);
+            writer.write(message);
+        }
+        writer.flush();
+    }
+
+    Protocol::DelimitedReader<MessageOne> reader(stream, 16);
+    int count = 0;
+    for (const MessageOne & message: reader)
+    {
+        verifyEqual(string(count, 'x'), message.sOne());
+        verifyEqual(1, message.sizeIOne());
+        verifyEqual(count, message.iOne(0));
+        ++count;
+    }
+    verifyEqual(50, count);
+    verifyFalse(reader.next());
+
+    MessageOne message;
+    message.setSOne("managed");
+    stringstream truncatedStream(message.serialize().substr(0, 3));
+    Protocol::DelimitedReader<MessageOne> truncatedReader(truncatedStream);
+
+    bool exceptionThrown = false;
+    try
+    {
+        truncatedReader.next();
+    }
+    catch (const Protocol::ProtocolBufferException &)
+    {
+        exceptionThrown = true;
+    }
+    verifyTrue(exceptionThrown);
+}
+
+DESIGNER_SCENARIO( MessageField, "Construction/Move", "Generated class can be moved without copying." )
+{
+    verifyTrue(std::is_nothrow_move_constructible<MessageOne>::value);
+    verifyTrue(std::is_nothrow_move_assignable<MessageOne>::value);
+
+    MessageOne originalMessage;
+    originalMessage.setSOne("managed");
+    originalMessage.addIOne(42);
+
+    MessageOne movedMessage(std::move(originalMessage));
+    verifyEqual(string("managed"), movedMessage.sOne());
+    verifyEqual(42, movedMessage.iOne(0));
+
+    MessageOne assignedMessage;
+    assignedMessage = std::move(movedMessage);
+    verifyEqual(string("managed"), assignedMessage.sOne());
+    verifyEqual(42, assignedMessage.iOne(0));
+
+    movedMessage = assignedMessage;
+    verifyEqual(string("managed"), movedMessage.sOne());
+}
+
+DESIGNER_SCENARIO( MessageField, "Construction/MovedFrom", "Generated class can be cleared and parsed after being moved." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("managed");
+    originalMessage.addIOne(42);
+    string serialized = originalMessage.serialize();
+
+    MessageOne movedMessage(std::move(originalMessage));
+    originalMessage.clear();
+    verifyFalse(originalMessage.hasSOne());
+    verifyEqual(0u, originalMessage.sizeIOne());
+    originalMessage.setSOne("again");
+    verifyEqual(string("again"), originalMessage.sOne());
+    verifyEqual(string("managed"), movedMessage.sOne());
+
+    MessageOne assignedMessage;
+    assignedMessage = std::move(movedMessage);
+    movedMessage.parse(serialized.data(), serialized.size());
+    verifyEqual(string("managed"), movedMessage.sOne());
+    verifyEqual(42, movedMessage.iOne(0));
+    verifyEqual(string("managed"), assignedMessage.sOne());
+}
+
+DESIGNER_SCENARIO( MessageField, "Construction/Clear", "Generated class clears in place and keeps the values of copies." )
+{
+    MessageOne originalMessage;
+    originalMessage.setSOne("managed");
+    for (int i = 0; i < 100; ++i)
+    {
+        originalMessage.addIOne(i);
+    }
+    const int32_t * numbers = originalMessage.iOneValues().data();
+
+    MessageOne copiedMessage(originalMessage);
+    originalMessage.clear();
+
+    verifyFalse(originalMessage.hasSOne());
+    verifyEqual(0, originalMessage.sizeIOne());
+    verifyEqual(string("managed"), copiedMessage.sOne());
+    verifyEqual(100, copiedMessage.sizeIOne());
+
+    copiedMessage.clear();
+    copiedMessage.addIOne(1);
+
+    verifyEqual(0, copiedMessage.sOne().size());
+    verifyEqual(1, copiedMessage.sizeIOne());
+    verifyTrue(numbers == copiedMessage.iOneValues().data());
+}
+
+DESIGNER_SCENARIO( MessageField, "Construction/Presence", "Generated class tracks which fields are set through parsing and clearing." )
+{
+    MessageOne originalMessage;
+    verifyFalse(originalMessage.hasSOne());
+    verifyFalse(originalMessage.hasBOne());
+
+    originalMessage.setBOne(false);
+    verifyFalse(originalMessage.hasSOne());
+    verifyTrue(originalMessage.hasBOne());
+
+    originalMessage.mutableSOne() = "mutable";
+    verifyTrue(originalMessage.hasSOne());
+
+    string serialized = originalMessage.serialize();
+
+    MessageOne parsedMessage;
+    parsedMessage.parse(serialized.data(), serialized.size());
+    verifyTrue(parsedMessage.hasSOne());
+    verifyTrue(parsedMessage.hasBOne());
+    verifyFalse(parsedMessage.bOne());
+
+    parsedMessage.clearBOne();
+    verifyFalse(parsedMessage.hasBOne());
+    verifyTrue(parsedMessage.hasSOne());
+
+    MessageOne expectedMessage;
+    expectedMessage.setSOne("mutable");
+    verifyEqual(expectedMessage.serialize(), parsedMessage.serialize());
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/OutOfOrder", "Generated class parses fields that arrive out of declaration order." )
+{
+    // bOne, an unknown field 9, and then sOne, all behind the message length.
+    const char serialized[] = {0x08, 0x10, 0x01, 0x48, 0x05, 0x0a, 0x02, 'a', 'b'};
+
+    MessageOne parsedMessage;
+    parsedMessage.parse(serialized, sizeof(serialized));
+    verifyTrue(parsedMessage.hasSOne());
+    verifyEqual("ab", parsedMessage.sOne());
+    verifyTrue(parsedMessage.hasBOne());
+    verifyTrue(parsedMessage.bOne());
+    verifyEqual(0, parsedMessage.sizeIOne());
+
+    MessageOne reparsedMessage;
+    string reserialized = parsedMessage.serialize();
+    reparsedMessage.parse(reserialized.data(), reserialized.size());
+    verifyEqual("ab", reparsedMessage.sOne());
+    verifyTrue(reparsedMessage.bOne());
+}
+
+DESIGNER_SCENARIO( MessageField, "Parsing/WireType", "Generated class keeps fields with an unexpected wire type as unknown fields." )
+{
+    // bOne as a length delimited "a" and then sOne as a VarInt with the value 5.
+    string serialized("\x05\x12\x01\x61\x08\x05", 6);
+
+    MessageOne parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyFalse(parsedMessage.hasBOne());
+    verifyFalse(parsedMessage.hasSOne());
+    verifyEqual(5u, parsedMessage.unknownFields().size());
+    verifyEqual(serialized, parsedMessage.serialize());
+}
+
+DESIGNER_SCENARIO( MessageField, "Serialization/Tags", "Generated class writes the precomputed tag of each field." )
+{
+    MessageOne message;
+    message.setSOne("a");
+    message.setBOne(true);
+    message.addIOne(5);
+    verifyEqual(string("\x08\x0a\x01" "a" "\x10\x01" "\x1a\x01\x05", 9), message.serialize());
+}
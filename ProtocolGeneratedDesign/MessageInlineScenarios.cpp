@@ -0,0 +1,265 @@
+//
+//  MessageInlineScenarios.cpp
+//  Protocol
+//
+//  Created by agent on 10/17/26.
+//
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Submodules/Designer/Designer/Designer.h"
+
+#include "../ProtocolDesign/Messages/Generated/MessageInline.protocol.h"
+
+using namespace std;
+using namespace MuddledManaged;
+
+DESIGNER_SCENARIO( MessageInline, "Construction/Copy", "Generated class with inline storage makes independent copies." )
+{
+    MessageInline originalMessage;
+    originalMessage.setSOne("original");
+    originalMessage.addIOne(1);
+    originalMessage.createNewMOne().setIOne(10);
+    originalMessage.setITwo(2);
+
+    MessageInline copiedMessage(originalMessage);
+    copiedMessage.setSOne("copy");
+    copiedMessage.addIOne(3);
+    copiedMessage.createNewMOne().setIOne(30);
+    copiedMessage.setSTwo("two");
+
+    verifyEqual(string("original"), originalMessage.sOne());
+    verifyEqual(1, originalMessage.sizeIOne());
+    verifyEqual(10, originalMessage.mOne().iOne());
+    verifyTrue(originalMessage.hasITwo());
+    verifyEqual(2, originalMessage.iTwo());
+
+    verifyEqual(string("copy"), copiedMessage.sOne());
+    verifyEqual(2, copiedMessage.sizeIOne());
+    verifyEqual(30, copiedMessage.mOne().iOne());
+    verifyTrue(copiedMessage.hasSTwo());
+
+    MessageInline assignedMessage;
+    assignedMessage = originalMessage;
+    originalMessage.clear();
+
+    verifyFalse(originalMessage.hasSOne());
+    verifyEqual(string("original"), assignedMessage.sOne());
+    verifyEqual(10, assignedMessage.mOne().iOne());
+}
+
+DESIGNER_SCENARIO( MessageInline, "Construction/CopyShared", "Generated class with inline storage copies the data of messages that share it." )
+{
+    MessageInlineMix originalMessage;
+    originalMessage.createNewMOne().setIOne(1);
+    originalMessage.mutableMOne().addITwo(2);
+    originalMessage.addNewMTwo().setIOne(3);
+
+    MessageInlineMix copiedMessage(originalMessage);
+    copiedMessage.mutableMOne().setIOne(10);
+    copiedMessage.mutableMOne().addITwo(11);
+    copiedMessage.mutableMTwo(0).setIOne(20);
+
+    verifyEqual(1, originalMessage.mOne().iOne());
+    verifyEqual(1u, originalMessage.mOne().sizeITwo());
+    verifyEqual(3, originalMessage.mTwo(0).iOne());
+    verifyEqual(10, copiedMessage.mOne().iOne());
+    verifyEqual(2u, copiedMessage.mOne().sizeITwo());
+    verifyEqual(20, copiedMessage.mTwo(0).iOne());
+
+    MessageInlineMix assignedMessage;
+    assignedMessage = originalMessage;
+    assignedMessage.mutableMOne().setIOne(30);
+    assignedMessage.mutableMTwo(0).setIOne(40);
+
+    verifyEqual(1, originalMessage.mOne().iOne());
+    verifyEqual(3, originalMessage.mTwo(0).iOne());
+
+    MessageInlineShared sharedMessage = originalMessage.mTwo(0).deepCopy();
+    sharedMessage.setIOne(50);
+    verifyEqual(3, originalMessage.mTwo(0).iOne());
+}
+
+DESIGNER_SCENARIO( MessageInline, "Construction/Move", "Generated class with inline storage moves its data." )
+{
+    verifyTrue(std::is_nothrow_move_constructible<MessageInline>::value);
+    verifyTrue(std::is_nothrow_move_assignable<MessageInline>::value);
+
+    MessageInline originalMessage;
+    originalMessage.setSOne(string(100, 'x'));
+    originalMessage.addIOne(1);
+    originalMessage.createNewMOne().setIOne(10);
+
+    MessageInline movedMessage(std::move(originalMessage));
+    verifyEqual(string(100, 'x'), movedMessage.sOne());
+    verifyEqual(1, movedMessage.iOne(0));
+    verifyEqual(10, movedMessage.mOne().iOne());
+
+    // Growing a vector moves the messages it already holds.
+    vector<MessageInline> messages;
+    for (int i = 0; i < 20; ++i)
+    {
+        messages.push_back(movedMessage);
+    }
+    for (auto & message: messages)
+    {
+        verifyEqual(string(100, 'x'), message.sOne());
+        verifyEqual(10, message.mOne().iOne());
+    }
+}
+
+DESIGNER_SCENARIO( MessageInline, "Parsing/Normal", "Generated class with inline storage can be serialized and parsed." )
+{
+    MessageInline originalMessage;
+    originalMessage.setSOne("inline");
+    originalMessage.addIOne(42);
+    originalMessage.createNewMOne().setIOne(-7);
+    originalMessage.setSTwo("two");
+
+    string serialized = originalMessage.serialize();
+
+    MessageInline parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyEqual(string("inline"), parsedMessage.sOne());
+    verifyEqual(42, parsedMessage.iOne(0));
+    verifyEqual(-7, parsedMessage.mOne().iOne());
+    verifyEqual(string("two"), parsedMessage.sTwo());
+
+    MessageInline otherMessage;
+    otherMessage.setSOne("other");
+    otherMessage.swap(&parsedMessage);
+
+    verifyEqual(string("other"), parsedMessage.sOne());
+    verifyEqual(string("inline"), otherMessage.sOne());
+}
+
+DESIGNER_SCENARIO( MessageInline, "Construction/CopyOnWrite", "Copy on write wrapper shares a message until it is changed." )
+{
+    MessageInline message;
+    message.setSOne("shared");
+
+    Protocol::CopyOnWrite<MessageInline> original(message);
+    Protocol::CopyOnWrite<MessageInline> copy(original);
+
+    verifyTrue(copy.shared());
+    verifyEqual(&original.value(), &copy.value());
+
+    copy.mutableValue().setSOne("changed");
+
+    verifyFalse(copy.shared());
+    verifyFalse(original.shared());
+    verifyEqual(string("shared"), original->sOne());
+    verifyEqual(string("changed"), copy->sOne());
+}
+
+DESIGNER_SCENARIO( MessageInline, "Construction/RvalueSetters", "Generated class takes strings and messages by rvalue without copying." )
+{
+    string longValue(1000, 'x');
+    const char * longData = longValue.data();
+
+    MessageInline message;
+    message.setSOne(std::move(longValue));
+    verifyEqual(longData, message.sOne().data());
+
+    string itemValue(1000, 'y');
+    const char * itemData = itemValue.data();
+    message.addSThree(std::move(itemValue));
+    verifyEqual(itemData, message.sThree(0).data());
+
+    MessageInlineInner inner;
+    inner.setIOne(5);
+    message.setMOne(std::move(inner));
+    verifyEqual(5, message.mOne().iOne());
+
+    MessageInlineInner item;
+    item.setIOne(6);
+    message.addMThree(std::move(item));
+    verifyEqual(6, message.mThree(0).iOne());
+
+    message.setSTwo(string("two"));
+    verifyTrue(message.hasSTwo());
+}
+
+DESIGNER_SCENARIO( MessageInline, "Construction/Mutable", "Generated class can change strings and messages in place." )
+{
+    MessageInline originalMessage;
+    originalMessage.mutableSOne() = "first";
+    originalMessage.mutableSOne() += " second";
+    originalMessage.mutableMOne().setIOne(10);
+    originalMessage.addSThree("item");
+    originalMessage.addNewMThree().setIOne(20);
+    originalMessage.setITwo(2);
+    originalMessage.mutableSTwo() = "two";
+
+    verifyEqual(string("first second"), originalMessage.sOne());
+    verifyEqual(10, originalMessage.mOne().iOne());
+    verifyTrue(originalMessage.hasSTwo());
+    verifyFalse(originalMessage.hasITwo());
+
+    // Changing a copy in place leaves the original alone.
+    MessageInline copiedMessage(originalMessage);
+    copiedMessage.mutableSOne() = "copy";
+    copiedMessage.mutableMOne().setIOne(11);
+    copiedMessage.mutableSThree(0) += "s";
+    copiedMessage.mutableMThree(0).setIOne(21);
+
+    verifyEqual(string("first second"), originalMessage.sOne());
+    verifyEqual(10, originalMessage.mOne().iOne());
+    verifyEqual(string("item"), originalMessage.sThree(0));
+    verifyEqual(20, originalMessage.mThree(0).iOne());
+
+    verifyEqual(string("copy"), copiedMessage.sOne());
+    verifyEqual(11, copiedMessage.mOne().iOne());
+    verifyEqual(string("items"), copiedMessage.sThree(0));
+    verifyEqual(21, copiedMessage.mThree(0).iOne());
+
+    MessageInline parsedMessage;
+    string serialized = copiedMessage.serialize();
+    parsedMessage.parse(serialized.data(), serialized.size());
+    verifyEqual(string("items"), parsedMessage.sThree(0));
+    verifyEqual(11, parsedMessage.mOne().iOne());
+}
+
+DESIGNER_SCENARIO( MessageInline, "Parsing/Reuse", "Generated class reuses its storage when parsed again." )
+{
+    MessageInline originalMessage;
+    originalMessage.setSOne(string(100, 'x'));
+    originalMessage.createNewMOne().setIOne(1);
+    for (int i = 0; i < 10; ++i)
+    {
+        originalMessage.addSThree(string(100, 'a' + i));
+        originalMessage.addNewMThree().setIOne(i);
+    }
+
+    string serialized = originalMessage.serialize();
+
+    MessageInline parsedMessage;
+    parsedMessage.parse(serialized.data(), serialized.size());
+
+    const char * sOneData = parsedMessage.sOne().data();
+    const MessageInlineInner * mOneAddress = &parsedMessage.mOne();
+    const char * sThreeData = parsedMessage.sThree(9).data();
+    const MessageInlineInner * mThreeAddress = &parsedMessage.mThree(9);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        parsedMessage.clear();
+        verifyFalse(parsedMessage.hasSOne());
+        verifyFalse(parsedMessage.hasMOne());
+        verifyEqual(0, parsedMessage.sizeSThree());
+        verifyEqual(0, parsedMessage.sizeMThree());
+
+        parsedMessage.parse(serialized.data(), serialized.size());
+
+        verifyTrue(sOneData == parsedMessage.sOne().data());
+        verifyTrue(mOneAddress == &parsedMessage.mOne());
+        verifyTrue(sThreeData == parsedMessage.sThree(9).data());
+        verifyTrue(mThreeAddress == &parsedMessage.mThree(9));
+        verifyEqual(serialized, parsedMessage.serialize());
+    }
+}
@@ -0,0 +1,114 @@
+//
+//  MessageLazyScenarios.cpp
+//  Protocol
+//
+//  Created by agent on 10/17/26.
+//
+
+#include <string>
+
+#include "../Submodules/Designer/Designer/Designer.h"
+
+#include "../ProtocolDesign/Messages/Generated/MessageLazy.protocol.h"
+
+using namespace std;
+using namespace MuddledManaged;
+
+DESIGNER_SCENARIO( MessageLazy, "Parsing/Lazy", "Generated class decodes a lazy field when it is first read." )
+{
+    MessageLazy originalMessage;
+    MessageLazyInner & lazyMessage = originalMessage.createNewLazyOne();
+    lazyMessage.setSOne("lazy");
+    lazyMessage.addIOne(1);
+    lazyMessage.addIOne(300);
+    originalMessage.createNewEagerOne().setSOne("eager");
+    originalMessage.setIOne(7);
+
+    string serialized = originalMessage.serialize();
+
+    MessageLazy parsedMessage;
+    size_t bytesParsed = parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyEqual(serialized.size(), bytesParsed);
+    verifyTrue(parsedMessage.hasLazyOne());
+    verifyEqual(serialized.size(), parsedMessage.byteSize());
+    verifyEqual(serialized, parsedMessage.serialize());
+
+    verifyEqual("lazy", parsedMessage.lazyOne().sOne());
+    verifyEqual(2, parsedMessage.lazyOne().sizeIOne());
+    verifyEqual(300, parsedMessage.lazyOne().iOne(1));
+    verifyEqual("eager", parsedMessage.eagerOne().sOne());
+    verifyEqual(7, parsedMessage.iOne());
+    verifyEqual(serialized, parsedMessage.serialize());
+}
+
+DESIGNER_SCENARIO( MessageLazy, "Parsing/LazyAliased", "Generated class can decode a lazy field that refers to the input buffer." )
+{
+    MessageLazy originalMessage;
+    originalMessage.createNewLazyOne().setSOne("lazy");
+
+    string serialized = originalMessage.serialize();
+
+    MessageLazy parsedMessage;
+    parsedMessage.parseAliased(serialized.data(), serialized.size());
+
+    MessageLazy copiedMessage;
+    copiedMessage = parsedMessage;
+
+    verifyEqual(serialized, copiedMessage.serialize());
+    verifyEqual("lazy", copiedMessage.lazyOne().sOne());
+
+    parsedMessage.createNewLazyOne().setSOne("replaced");
+
+    verifyEqual("replaced", parsedMessage.lazyOne().sOne());
+}
+
+DESIGNER_SCENARIO( MessageLazy, "Construction/Valid", "Generated class is only valid when required fields of its submessages are set." )
+{
+    MessageLazy message;
+    verifyTrue(message.valid());
+
+    message.setIOne(1);
+    verifyTrue(message.valid());
+
+    message.mutableEagerOne();
+    verifyFalse(message.valid());
+
+    message.mutableEagerOne().setSOne("eager");
+    verifyTrue(message.valid());
+
+    message.mutableLazyOne().addIOne(2);
+    verifyFalse(message.valid());
+
+    message.mutableLazyOne().setSOne("lazy");
+    verifyTrue(message.valid());
+
+    message.clear();
+    verifyTrue(message.valid());
+}
+
+DESIGNER_SCENARIO( MessageLazy, "Construction/DeepCopy", "Generated class changes a lazy field of a deep copy without changing the original." )
+{
+    MessageLazy originalMessage;
+    originalMessage.createNewLazyOne().setSOne("original");
+    originalMessage.mutableLazyOne().addIOne(1);
+
+    MessageLazy copiedMessage = originalMessage.deepCopy();
+    copiedMessage.mutableLazyOne().setSOne("copy");
+    copiedMessage.mutableLazyOne().addIOne(2);
+
+    verifyEqual("original", originalMessage.lazyOne().sOne());
+    verifyEqual(1, originalMessage.lazyOne().sizeIOne());
+    verifyEqual("copy", copiedMessage.lazyOne().sOne());
+    verifyEqual(2, copiedMessage.lazyOne().sizeIOne());
+
+    string serialized = originalMessage.serialize();
+    MessageLazy parsedMessage;
+    parsedMessage.parse(serialized.data(), serialized.size());
+
+    MessageLazy parsedCopy = parsedMessage.deepCopy();
+    parsedCopy.mutableLazyOne().setSOne("parsed copy");
+
+    verifyEqual("original", parsedMessage.lazyOne().sOne());
+    verifyEqual("parsed copy", parsedCopy.lazyOne().sOne());
+}
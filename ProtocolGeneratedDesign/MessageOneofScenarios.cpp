@@ -32,3 +32,23 @@ DESIGNER_SCENARIO( MessageOneof, "Serialization/Normal", "Generated class can be
 
     verifyEqual(stringValue, parsedMessage.sOne());
 }
+
+DESIGNER_SCENARIO( MessageOneof, "Serialization/ByteSize", "Generated class byte size includes the oneof choice." )
+{
+    MessageOneof originalMessage;
+    originalMessage.setIOne(300);
+
+    string serialized = originalMessage.serialize();
+    verifyEqual(serialized.size(), originalMessage.byteSize());
+
+    originalMessage.setSOne("managed");
+
+    serialized = originalMessage.serialize();
+    verifyEqual(serialized.size(), originalMessage.byteSize());
+
+    MessageOneof parsedMessage;
+    parsedMessage.parse(serialized.data(), serialized.size());
+
+    verifyTrue(parsedMessage.currentChoicesOneofChoice() == MessageOneof::ChoicesOneofChoices::sOne);
+    verifyEqual(string("managed"), parsedMessage.sOne());
+}
@@ -0,0 +1,87 @@
+//
+//  MessageRepeatedScenarios.cpp
+//  Protocol
+//
+//  Created by agent on 10/17/26.
+//
+
+#include <string>
+#include <vector>
+
+#include "../Submodules/Designer/Designer/Designer.h"
+
+#include "../ProtocolDesign/Messages/Generated/MessageRepeated.protocol.h"
+
+using namespace std;
+using namespace MuddledManaged;
+
+DESIGNER_SCENARIO( MessageRepeated, "Repeated/Reserve", "Generated class keeps references to new repeated messages within the reserved space." )
+{
+    MessageRepeated message;
+    message.reserveMOne(4);
+
+    MessageRepeatedItem & first = message.addNewMOne();
+    first.setSOne("first");
+    for (int i = 1; i < 4; ++i)
+    {
+        message.addNewMOne().setSOne("more");
+    }
+
+    verifyEqual(4, message.sizeMOne());
+    verifyTrue(&first == message.mOneValues().begin());
+    verifyEqual("first", first.sOne());
+}
+
+DESIGNER_SCENARIO( MessageRepeated, "Repeated/Values", "Generated class iterates repeated messages in order." )
+{
+    MessageRepeated message;
+    MessageRepeatedItem value;
+    value.setSOne("copied");
+    message.addMOne(value);
+    message.addNewMOne().setSOne("in place");
+    message.addNewMOne().addIOne(3);
+
+    vector<string> names;
+    for (auto & item: message.mOneValues())
+    {
+        names.push_back(item.sOne());
+    }
+    verifyEqual(3, message.mOneValues().size());
+    verifyEqual("copied", names[0]);
+    verifyEqual("in place", names[1]);
+    verifyEqual("", names[2]);
+    verifyEqual(3, message.mOneValues()[2].iOne(0));
+
+    message.mutableMOne(0).setSOne("changed");
+    verifyEqual("changed", message.mOne(0).sOne());
+}
+
+DESIGNER_SCENARIO( MessageRepeated, "Repeated/RoundTrip", "Generated class serializes and parses repeated messages." )
+{
+    MessageRepeated originalMessage;
+    originalMessage.setIOne(7);
+    for (int i = 0; i < 3; ++i)
+    {
+        MessageRepeatedItem & item = originalMessage.addNewMOne();
+        item.setSOne(string(static_cast<size_t>(i + 1), 'x'));
+        item.setBOne(i == 1);
+        item.addIOne(i);
+        item.addIOne(-i);
+    }
+
+    string serialized = originalMessage.serialize();
+    verifyEqual(serialized.size(), originalMessage.byteSize());
+
+    MessageRepeated parsedMessage;
+    verifyEqual(serialized.size(), parsedMessage.parse(serialized.data(), serialized.size()));
+    verifyEqual(3, parsedMessage.sizeMOne());
+    verifyEqual(7, parsedMessage.iOne());
+    for (int i = 0; i < 3; ++i)
+    {
+        verifyEqual(string(static_cast<size_t>(i + 1), 'x'), parsedMessage.mOne(i).sOne());
+        verifyEqual(i == 1, parsedMessage.mOne(i).bOne());
+        verifyEqual(2, parsedMessage.mOne(i).sizeIOne());
+        verifyEqual(-i, parsedMessage.mOne(i).iOne(1));
+    }
+    verifyEqual(serialized, parsedMessage.serialize());
+}
@@ -0,0 +1,185 @@
+//
+//  PrimitiveEncodingScenarios.cpp
+//  Protocol
+//
+//  Created by agent on 10/17/26.
+//
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../Submodules/Designer/Designer/Designer.h"
+
+#include "../ProtocolDesign/Messages/Generated/ProtoBase.protocol.h"
+
+using namespace std;
+using namespace MuddledManaged;
+
+namespace
+{
+    enum class PackedEnum
+    {
+        zero = 0,
+        large = 300,
+        negative = -1
+    };
+}
+
+DESIGNER_SCENARIO( PrimitiveEncoding, "Size/Boundaries", "VarInt sizes match the serialized length at every 7 bit boundary." )
+{
+    vector<uint64_t> values;
+    values.push_back(0);
+    for (unsigned int bit = 7; bit < 64; bit += 7)
+    {
+        values.push_back((1ULL << bit) - 1);
+        values.push_back(1ULL << bit);
+    }
+    values.push_back(1ULL << 63);
+    values.push_back(numeric_limits<uint64_t>::max());
+
+    for (auto value: values)
+    {
+        verifyEqual(Protocol::PrimitiveEncoding::serializeVariableUnsignedInt64(value).size(),
+                    Protocol::PrimitiveEncoding::sizeVariableUnsignedInt64(value));
+        verifyEqual(Protocol::PrimitiveEncoding::serializeVariableInt64(static_cast<int64_t>(value)).size(),
+                    Protocol::PrimitiveEncoding::sizeVariableInt64(static_cast<int64_t>(value)));
+        verifyEqual(Protocol::PrimitiveEncoding::serializeVariableSignedInt64(static_cast<int64_t>(value)).size(),
+                    Protocol::PrimitiveEncoding::sizeVariableSignedInt64(static_cast<int64_t>(value)));
+
+        if (value <= numeric_limits<uint32_t>::max())
+        {
+            uint32_t value32 = static_cast<uint32_t>(value);
+            verifyEqual(Protocol::PrimitiveEncoding::serializeVariableUnsignedInt32(value32).size(),
+                        Protocol::PrimitiveEncoding::sizeVariableUnsignedInt32(value32));
+            verifyEqual(Protocol::PrimitiveEncoding::serializeVariableInt32(static_cast<int32_t>(value32)).size(),
+                        Protocol::PrimitiveEncoding::sizeVariableInt32(static_cast<int32_t>(value32)));
+            verifyEqual(Protocol::PrimitiveEncoding::serializeVariableSignedInt32(static_cast<int32_t>(value32)).size(),
+                        Protocol::PrimitiveEncoding::sizeVariableSignedInt32(static_cast<int32_t>(value32)));
+        }
+    }
+
+    verifyEqual(1u, Protocol::PrimitiveEncoding::sizeVariableUnsignedInt64(0));
+    verifyEqual(2u, Protocol::PrimitiveEncoding::sizeVariableUnsignedInt64(128));
+    verifyEqual(10u, Protocol::PrimitiveEncoding::sizeVariableUnsignedInt64(numeric_limits<uint64_t>::max()));
+}
+
+DESIGNER_SCENARIO( PrimitiveEncoding, "Size/Negative", "Negative ints take ten bytes and zig-zag ints stay small." )
+{
+    vector<int32_t> negatives32 = {-1, -64, -65, numeric_limits<int32_t>::min()};
+    for (auto value: negatives32)
+    {
+        verifyEqual(10u, Protocol::PrimitiveEncoding::sizeVariableInt32(value));
+        verifyEqual(10u, Protocol::PrimitiveEncoding::serializeVariableInt32(value).size());
+    }
+
+    vector<int64_t> negatives64 = {-1, -64, -65, numeric_limits<int64_t>::min()};
+    for (auto value: negatives64)
+    {
+        verifyEqual(10u, Protocol::PrimitiveEncoding::sizeVariableInt64(value));
+        verifyEqual(10u, Protocol::PrimitiveEncoding::serializeVariableInt64(value).size());
+    }
+
+    verifyEqual(1u, Protocol::PrimitiveEncoding::sizeVariableSignedInt32(-1));
+    verifyEqual(1u, Protocol::PrimitiveEncoding::sizeVariableSignedInt32(63));
+    verifyEqual(1u, Protocol::PrimitiveEncoding::sizeVariableSignedInt32(-64));
+    verifyEqual(2u, Protocol::PrimitiveEncoding::sizeVariableSignedInt32(64));
+    verifyEqual(2u, Protocol::PrimitiveEncoding::sizeVariableSignedInt32(-65));
+    verifyEqual(5u, Protocol::PrimitiveEncoding::sizeVariableSignedInt32(numeric_limits<int32_t>::min()));
+    verifyEqual(5u, Protocol::PrimitiveEncoding::serializeVariableSignedInt32(numeric_limits<int32_t>::min()).size());
+    verifyEqual(5u, Protocol::PrimitiveEncoding::sizeVariableSignedInt32(numeric_limits<int32_t>::max()));
+    verifyEqual(1u, Protocol::PrimitiveEncoding::sizeVariableSignedInt64(-1));
+    verifyEqual(2u, Protocol::PrimitiveEncoding::sizeVariableSignedInt64(-65));
+    verifyEqual(10u, Protocol::PrimitiveEncoding::sizeVariableSignedInt64(numeric_limits<int64_t>::min()));
+    verifyEqual(10u, Protocol::PrimitiveEncoding::serializeVariableSignedInt64(numeric_limits<int64_t>::min()).size());
+    verifyEqual(10u, Protocol::PrimitiveEncoding::sizeVariableSignedInt64(numeric_limits<int64_t>::max()));
+}
+
+DESIGNER_SCENARIO( PrimitiveEncoding, "Packed/RoundTrip", "Packed VarInt kernels size, write, and parse the same values." )
+{
+    vector<int32_t> int32Values = {0, 1, -1, 300, numeric_limits<int32_t>::min(), numeric_limits<int32_t>::max()};
+    size_t size = Protocol::PrimitiveEncoding::sizePackedVariableInt32(int32Values.data(), int32Values.size());
+    vector<char> buffer(size);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedVariableInt32(int32Values.data(), int32Values.size(), buffer.data()) ==
+               buffer.data() + size);
+    vector<int32_t> int32Parsed(int32Values.size());
+    size_t bytesParsed = 0;
+    verifyEqual(int32Values.size(), Protocol::PrimitiveEncoding::parsePackedVariableInt32(buffer.data(), size, int32Parsed.data(),
+                                                                                             int32Parsed.size(), &bytesParsed));
+    verifyEqual(size, bytesParsed);
+    verifyTrue(int32Values == int32Parsed);
+
+    vector<int64_t> int64Values = {0, 1, -1, 1LL << 40, numeric_limits<int64_t>::min(), numeric_limits<int64_t>::max()};
+    size = Protocol::PrimitiveEncoding::sizePackedVariableInt64(int64Values.data(), int64Values.size());
+    buffer.assign(size, 0);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedVariableInt64(int64Values.data(), int64Values.size(), buffer.data()) ==
+               buffer.data() + size);
+    vector<int64_t> int64Parsed(int64Values.size());
+    verifyEqual(int64Values.size(), Protocol::PrimitiveEncoding::parsePackedVariableInt64(buffer.data(), size, int64Parsed.data(),
+                                                                                             int64Parsed.size(), &bytesParsed));
+    verifyEqual(size, bytesParsed);
+    verifyTrue(int64Values == int64Parsed);
+
+    vector<uint32_t> uint32Values = {0, 127, 128, 16383, 16384, numeric_limits<uint32_t>::max()};
+    size = Protocol::PrimitiveEncoding::sizePackedVariableUnsignedInt32(uint32Values.data(), uint32Values.size());
+    buffer.assign(size, 0);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedVariableUnsignedInt32(uint32Values.data(), uint32Values.size(), buffer.data()) ==
+               buffer.data() + size);
+    vector<uint32_t> uint32Parsed(uint32Values.size());
+    verifyEqual(uint32Values.size(), Protocol::PrimitiveEncoding::parsePackedVariableUnsignedInt32(buffer.data(), size, uint32Parsed.data(),
+                                                                                                      uint32Parsed.size(), &bytesParsed));
+    verifyEqual(size, bytesParsed);
+    verifyTrue(uint32Values == uint32Parsed);
+
+    vector<uint64_t> uint64Values = {0, 127, 128, 1ULL << 56, 1ULL << 63, numeric_limits<uint64_t>::max()};
+    size = Protocol::PrimitiveEncoding::sizePackedVariableUnsignedInt64(uint64Values.data(), uint64Values.size());
+    buffer.assign(size, 0);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedVariableUnsignedInt64(uint64Values.data(), uint64Values.size(), buffer.data()) ==
+               buffer.data() + size);
+    vector<uint64_t> uint64Parsed(uint64Values.size());
+    verifyEqual(uint64Values.size(), Protocol::PrimitiveEncoding::parsePackedVariableUnsignedInt64(buffer.data(), size, uint64Parsed.data(),
+                                                                                                      uint64Parsed.size(), &bytesParsed));
+    verifyEqual(size, bytesParsed);
+    verifyTrue(uint64Values == uint64Parsed);
+
+    vector<int32_t> sint32Values = {0, -1, 63, -64, 64, numeric_limits<int32_t>::min()};
+    size = Protocol::PrimitiveEncoding::sizePackedVariableSignedInt32(sint32Values.data(), sint32Values.size());
+    buffer.assign(size, 0);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedVariableSignedInt32(sint32Values.data(), sint32Values.size(), buffer.data()) ==
+               buffer.data() + size);
+    vector<int32_t> sint32Parsed(sint32Values.size());
+    verifyEqual(sint32Values.size(), Protocol::PrimitiveEncoding::parsePackedVariableSignedInt32(buffer.data(), size, sint32Parsed.data(),
+                                                                                                    sint32Parsed.size(), &bytesParsed));
+    verifyEqual(size, bytesParsed);
+    verifyTrue(sint32Values == sint32Parsed);
+
+    vector<int64_t> sint64Values = {0, -1, 63, -64, numeric_limits<int64_t>::min(), numeric_limits<int64_t>::max()};
+    size = Protocol::PrimitiveEncoding::sizePackedVariableSignedInt64(sint64Values.data(), sint64Values.size());
+    buffer.assign(size, 0);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedVariableSignedInt64(sint64Values.data(), sint64Values.size(), buffer.data()) ==
+               buffer.data() + size);
+    vector<int64_t> sint64Parsed(sint64Values.size());
+    verifyEqual(sint64Values.size(), Protocol::PrimitiveEncoding::parsePackedVariableSignedInt64(buffer.data(), size, sint64Parsed.data(),
+                                                                                                    sint64Parsed.size(), &bytesParsed));
+    verifyEqual(size, bytesParsed);
+    verifyTrue(sint64Values == sint64Parsed);
+
+    vector<PackedEnum> enumValues = {PackedEnum::zero, PackedEnum::large, PackedEnum::negative};
+    size = Protocol::PrimitiveEncoding::sizePackedVariableEnum(enumValues.data(), enumValues.size());
+    verifyEqual(1u + 2u + 10u, size);
+    buffer.assign(size, 0);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedVariableEnum(enumValues.data(), enumValues.size(), buffer.data()) ==
+               buffer.data() + size);
+    vector<PackedEnum> enumParsed(enumValues.size());
+    verifyEqual(enumValues.size(), Protocol::PrimitiveEncoding::parsePackedVariableEnum(buffer.data(), size, enumParsed.data(),
+                                                                                           enumParsed.size(), &bytesParsed));
+    verifyEqual(size, bytesParsed);
+    verifyTrue(enumValues == enumParsed);
+
+    vector<uint8_t> boolValues = {1, 0, 1};
+    buffer.assign(boolValues.size(), 0);
+    verifyTrue(Protocol::PrimitiveEncoding::serializePackedBool(boolValues.data(), boolValues.size(), buffer.data()) ==
+               buffer.data() + boolValues.size());
+    verifyEqual(string("\x01\x00\x01", 3), string(buffer.data(), buffer.size()));
+}